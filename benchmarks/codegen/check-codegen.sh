@@ -0,0 +1,62 @@
+#!/usr/bin/env bash
+#
+# usage: check-codegen.sh <objdump> <object file or static library>
+#
+# Count the instructions of every raw_<name>/ztd_<name> function pair in the
+# disassembly, and fail if ztd_<name> has more instructions than raw_<name>.
+
+objdump="${1}"
+object="${2}"
+
+if [[ -z "${objdump}" || -z "${object}" ]]; then
+    echo "usage: ${0} <objdump> <object>"
+    exit 2
+fi
+
+"${objdump}" --no-show-raw-insn --demangle -d "${object}" | awk '
+    # function header, "0000000000000000 <raw_add_u64(unsigned long, unsigned long)>:"
+    /^[0-9a-f]+ <.*>:$/ {
+        name = $0
+        sub(/^[0-9a-f]+ </, "", name)
+        sub(/\(.*$/, "", name)
+        sub(/>:$/, "", name)
+        next
+    }
+
+    # alignment padding between functions is not part of the function
+    /^ +[0-9a-f]+:\t(nop|xchg +%ax,%ax|cs nopw|data16|int3)/ { next }
+
+    /^ +[0-9a-f]+:\t/ {
+        if (name ~ /^(raw|ztd)_/) {
+            count[name]++
+        }
+    }
+
+    END {
+        failed = 0
+        checked = 0
+        for (fn in count) {
+            if (fn !~ /^raw_/) {
+                continue
+            }
+            op = substr(fn, 5)
+            wrapper = "ztd_" op
+            if (!(wrapper in count)) {
+                printf("MISSING %-28s no %s\n", op, wrapper)
+                failed = 1
+                continue
+            }
+            checked++
+            status = count[wrapper] > count[fn] ? "FAIL" : "OK"
+            if (status == "FAIL") {
+                failed = 1
+            }
+            printf("%-7s %-28s raw %3d  ztd %3d\n", status, op, count[fn], count[wrapper])
+        }
+        if (checked == 0) {
+            print "no raw_/ztd_ function pairs found"
+            exit 1
+        }
+        exit failed
+    }
+'
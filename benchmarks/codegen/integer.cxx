@@ -0,0 +1,331 @@
+/**
+ * Copyright (C) 2025 Brandon Zorn <brandonzorn@cock.li>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <optional>
+#include <utility>
+
+#include <cstdint>
+
+#include "ztd/ztd.hxx"
+
+// Pairs of functions doing the same work, raw_<name> with the compiler builtins
+// and ztd_<name> with ztd::integer. check-codegen.sh fails if any ztd_<name>
+// compiles to more instructions than its raw_<name> twin.
+//
+// Failure paths panic on the same condition with the same message as
+// ztd::integer, and the raw pow, ilog and isqrt twins use the same algorithm as
+// ztd::integer, so that only the wrapper overhead is measured.
+
+
+struct i64_overflow
+{
+    std::int64_t value;
+    bool overflow;
+};
+
+// wrapping
+
+std::uint64_t
+raw_wrapping_add_u64(const std::uint64_t a, const std::uint64_t b)
+{
+    return a + b;
+}
+
+std::uint64_t
+ztd_wrapping_add_u64(const std::uint64_t a, const std::uint64_t b)
+{
+    return ztd::u64(a).wrapping_add(ztd::u64(b)).data();
+}
+
+std::int64_t
+raw_wrapping_mul_i64(const std::int64_t a, const std::int64_t b)
+{
+    std::int64_t r;
+    (void)__builtin_mul_overflow(a, b, &r);
+    return r;
+}
+
+std::int64_t
+ztd_wrapping_mul_i64(const std::int64_t a, const std::int64_t b)
+{
+    return ztd::i64(a).wrapping_mul(ztd::i64(b)).data();
+}
+
+// overflowing
+
+i64_overflow
+raw_overflowing_add_i64(const std::int64_t a, const std::int64_t b)
+{
+    std::int64_t r;
+    const bool overflow = __builtin_add_overflow(a, b, &r);
+    return {r, overflow};
+}
+
+i64_overflow
+ztd_overflowing_add_i64(const std::int64_t a, const std::int64_t b)
+{
+    const auto [r, overflow] = ztd::i64(a).overflowing_add(ztd::i64(b));
+    return {r.data(), overflow};
+}
+
+// checked
+
+std::optional<ztd::u64>
+raw_checked_add_u64(const std::uint64_t a, const std::uint64_t b)
+{
+    std::uint64_t r;
+    if (__builtin_add_overflow(a, b, &r))
+    {
+        return std::nullopt;
+    }
+    return ztd::u64(r);
+}
+
+std::optional<ztd::u64>
+ztd_checked_add_u64(const std::uint64_t a, const std::uint64_t b)
+{
+    return ztd::u64(a).checked_add(ztd::u64(b));
+}
+
+std::optional<ztd::i64>
+raw_checked_sub_i64(const std::int64_t a, const std::int64_t b)
+{
+    std::int64_t r;
+    if (__builtin_sub_overflow(a, b, &r))
+    {
+        return std::nullopt;
+    }
+    return ztd::i64(r);
+}
+
+std::optional<ztd::i64>
+ztd_checked_sub_i64(const std::int64_t a, const std::int64_t b)
+{
+    return ztd::i64(a).checked_sub(ztd::i64(b));
+}
+
+std::optional<ztd::i64>
+raw_checked_mul_i64(const std::int64_t a, const std::int64_t b)
+{
+    std::int64_t r;
+    if (__builtin_mul_overflow(a, b, &r))
+    {
+        return std::nullopt;
+    }
+    return ztd::i64(r);
+}
+
+std::optional<ztd::i64>
+ztd_checked_mul_i64(const std::int64_t a, const std::int64_t b)
+{
+    return ztd::i64(a).checked_mul(ztd::i64(b));
+}
+
+// saturating
+
+std::int64_t
+raw_saturating_add_i64(const std::int64_t a, const std::int64_t b)
+{
+    return std::saturating_add(a, b);
+}
+
+std::int64_t
+ztd_saturating_add_i64(const std::int64_t a, const std::int64_t b)
+{
+    return ztd::i64(a).saturating_add(ztd::i64(b)).data();
+}
+
+// strict
+
+std::int64_t
+raw_strict_add_i64(const std::int64_t a, const std::int64_t b)
+{
+    std::int64_t r;
+    if (__builtin_add_overflow(a, b, &r)) [[unlikely]]
+    {
+        ztd::panic("attempt to add with overflow");
+    }
+    return r;
+}
+
+std::int64_t
+ztd_strict_add_i64(const std::int64_t a, const std::int64_t b)
+{
+    return ztd::i64(a).strict_add(ztd::i64(b)).data();
+}
+
+// division
+
+std::int64_t
+raw_wrapping_div_i64(const std::int64_t a, const std::int64_t b)
+{
+    if (b == 0) [[unlikely]]
+    {
+        ztd::panic("attempt to divide by zero");
+    }
+    const bool overflow = a == std::numeric_limits<std::int64_t>::min() && b == -1;
+    return a / (overflow ? 1 : b);
+}
+
+std::int64_t
+ztd_wrapping_div_i64(const std::int64_t a, const std::int64_t b)
+{
+    return ztd::i64(a).wrapping_div(ztd::i64(b)).data();
+}
+
+std::uint64_t
+raw_div_u64(const std::uint64_t a, const std::uint64_t b)
+{
+    if (b == 0) [[unlikely]]
+    {
+        ztd::panic("attempt to divide by zero");
+    }
+    return a / b;
+}
+
+std::uint64_t
+ztd_div_u64(const std::uint64_t a, const std::uint64_t b)
+{
+    return ztd::u64(a).wrapping_div(ztd::u64(b)).data();
+}
+
+// bit ops
+
+std::uint32_t
+raw_count_ones_u64(const std::uint64_t a)
+{
+    return std::uint32_t(std::popcount(a));
+}
+
+std::uint32_t
+ztd_count_ones_u64(const std::uint64_t a)
+{
+    return ztd::u64(a).count_ones().data();
+}
+
+std::uint32_t
+raw_leading_zeros_u64(const std::uint64_t a)
+{
+    return std::uint32_t(std::countl_zero(a));
+}
+
+std::uint32_t
+ztd_leading_zeros_u64(const std::uint64_t a)
+{
+    return ztd::u64(a).leading_zeros().data();
+}
+
+std::uint32_t
+raw_trailing_zeros_u64(const std::uint64_t a)
+{
+    return std::uint32_t(std::countr_zero(a));
+}
+
+std::uint32_t
+ztd_trailing_zeros_u64(const std::uint64_t a)
+{
+    return ztd::u64(a).trailing_zeros().data();
+}
+
+std::uint64_t
+raw_rotate_left_u64(const std::uint64_t a, const std::int32_t n)
+{
+    return std::rotl(a, n);
+}
+
+std::uint64_t
+ztd_rotate_left_u64(const std::uint64_t a, const std::int32_t n)
+{
+    return ztd::u64(a).rotate_left(ztd::i32(n)).data();
+}
+
+std::uint64_t
+raw_swap_bytes_u64(const std::uint64_t a)
+{
+    return std::byteswap(a);
+}
+
+std::uint64_t
+ztd_swap_bytes_u64(const std::uint64_t a)
+{
+    return ztd::u64(a).swap_bytes().data();
+}
+
+// pow, ilog, isqrt
+
+std::uint64_t
+raw_wrapping_pow_u64(const std::uint64_t a, const std::uint32_t exp)
+{
+    if (a == 0)
+    {
+        return 0;
+    }
+    std::uint64_t r = 1;
+    for (std::uint32_t i = 0; i < exp; ++i)
+    {
+        r *= a;
+    }
+    return r;
+}
+
+std::uint64_t
+ztd_wrapping_pow_u64(const std::uint64_t a, const std::uint32_t exp)
+{
+    return ztd::u64(a).wrapping_pow(ztd::u32(exp)).data();
+}
+
+std::uint32_t
+raw_ilog2_u64(const std::uint64_t a)
+{
+    ztd::panic_if(std::cmp_less_equal(a, 0), "argument of integer logarithm must be positive");
+    return std::uint32_t(std::log2(a));
+}
+
+std::uint32_t
+ztd_ilog2_u64(const std::uint64_t a)
+{
+    return ztd::u64(a).ilog2().data();
+}
+
+std::uint32_t
+raw_ilog10_u64(const std::uint64_t a)
+{
+    ztd::panic_if(std::cmp_less_equal(a, 0), "argument of integer logarithm must be positive");
+    return std::uint32_t(std::log10(a));
+}
+
+std::uint32_t
+ztd_ilog10_u64(const std::uint64_t a)
+{
+    return ztd::u64(a).ilog10().data();
+}
+
+std::int64_t
+raw_isqrt_i64(const std::int64_t a)
+{
+    ztd::panic_if(std::cmp_less(a, 0), "argument of integer square root cannot be negative");
+    return std::int64_t(std::sqrt(a));
+}
+
+std::int64_t
+ztd_isqrt_i64(const std::int64_t a)
+{
+    return ztd::i64(a).isqrt().data();
+}
@@ -0,0 +1,112 @@
+/**
+ * Copyright (C) 2025 Brandon Zorn <brandonzorn@cock.li>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <array>
+#include <span>
+
+#include <cstddef>
+#include <cstdint>
+
+#include <sys/random.h>
+
+#include <benchmark/benchmark.h>
+
+#include "ztd/ztd.hxx"
+
+/**
+ *
+ * Benchmarks
+ *
+ * Tokens per second from the fast engine, from the per-thread getrandom(2)
+ * buffer, and from one getrandom(2) call per token.
+ *
+ */
+
+static void
+BM_random_hex(benchmark::State& state)
+{
+    const auto len = ztd::usize(std::size_t(state.range(0)));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(ztd::random_hex(len));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void
+BM_random_string(benchmark::State& state)
+{
+    const auto len = ztd::usize(std::size_t(state.range(0)));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(ztd::random_string(len));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void
+BM_secure_random_hex(benchmark::State& state)
+{
+    const auto len = ztd::usize(std::size_t(state.range(0)));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(ztd::secure_random_hex(len));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void
+BM_secure_random_string(benchmark::State& state)
+{
+    const auto len = ztd::usize(std::size_t(state.range(0)));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(ztd::secure_random_string(len));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void
+BM_secure_random_bytes(benchmark::State& state)
+{
+    std::array<std::byte, 16> bytes;
+    for (auto _ : state)
+    {
+        ztd::secure_random_bytes(bytes);
+        benchmark::DoNotOptimize(bytes.data());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void
+BM_getrandom_unbuffered(benchmark::State& state)
+{
+    std::array<std::byte, 16> bytes;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(::getrandom(bytes.data(), bytes.size(), 0));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_random_hex)->Arg(16)->Arg(32)->Arg(64);
+BENCHMARK(BM_random_string)->Arg(16)->Arg(32)->Arg(64);
+BENCHMARK(BM_secure_random_hex)->Arg(16)->Arg(32)->Arg(64);
+BENCHMARK(BM_secure_random_string)->Arg(16)->Arg(32)->Arg(64);
+
+BENCHMARK(BM_secure_random_bytes);
+BENCHMARK(BM_getrandom_unbuffered);
@@ -0,0 +1,270 @@
+/**
+ * Copyright (C) 2025 Brandon Zorn <brandonzorn@cock.li>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <filesystem>
+#include <format>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+
+#include "ztd/ztd.hxx"
+
+/**
+ *
+ * Benchmarks
+ *
+ * Lookups per second from 1 to 64 threads, with one shard (every thread
+ * contends on the same lock) and with the default number of shards.
+ *
+ * Lookups in a bounded cache, where every hit also updates the eviction
+ * policy.
+ *
+ * Lookups of path keys by a std::string_view, which has to be converted to a
+ * path first unless the cache uses a transparent hash.
+ *
+ * create() hits with the creator passed as is, and wrapped in a std::function
+ * the way create() used to take it.
+ *
+ */
+
+static constexpr std::int64_t key_count = 4096;
+
+struct cache_data final
+{
+    std::int64_t data;
+};
+
+using cache_type = ztd::smart_cache<std::int64_t, cache_data>;
+
+/**
+ * @return a cache with key_count live entries, that are kept alive
+ */
+template<std::size_t Shards>
+static cache_type&
+cache() noexcept
+{
+    static cache_type c(Shards);
+    static const auto values = []
+    {
+        std::vector<std::shared_ptr<cache_data>> v;
+        for (std::int64_t key = 0; key < key_count; ++key)
+        {
+            v.push_back(c.create(key, [key] { return std::make_shared<cache_data>(key); }));
+        }
+        return v;
+    }();
+    (void)values;
+    return c;
+}
+
+template<std::size_t Shards>
+static void
+BM_at(benchmark::State& state)
+{
+    auto& c = cache<Shards>();
+    auto key = std::int64_t(state.thread_index()) * 7919;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(c.at(key % key_count));
+        key += 1;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+/**
+ * @return a bounded cache that keeps key_count / 2 of key_count entries alive
+ */
+template<ztd::cache_eviction Eviction>
+static cache_type&
+bounded_cache() noexcept
+{
+    static cache_type c(key_count / 2, Eviction);
+    static const bool filled = []
+    {
+        for (std::int64_t key = 0; key < key_count; ++key)
+        {
+            (void)c.create(key, [key] { return std::make_shared<cache_data>(key); });
+        }
+        return true;
+    }();
+    (void)filled;
+    return c;
+}
+
+template<ztd::cache_eviction Eviction>
+static void
+BM_at_bounded(benchmark::State& state)
+{
+    auto& c = bounded_cache<Eviction>();
+    const auto before = c.stats();
+    auto key = std::int64_t(state.thread_index()) * 7919;
+    for (auto _ : state)
+    {
+        // skewed, 3 of 4 lookups are for the 1/8 of the keys that are hot
+        const auto k = (key % 4 == 0) ? key % key_count : key % (key_count / 8);
+        benchmark::DoNotOptimize(c.create(k, [k] { return std::make_shared<cache_data>(k); }));
+        key += 1;
+    }
+    state.SetItemsProcessed(state.iterations());
+
+    if (state.thread_index() == 0)
+    {
+        const auto after = c.stats();
+        const auto hits = double(after.hits - before.hits);
+        const auto misses = double(after.misses - before.misses);
+        state.counters["hit_rate"] = hits / (hits + misses);
+    }
+}
+
+template<typename Cache>
+static void
+BM_at_path(benchmark::State& state)
+{
+    static Cache c;
+    static const auto paths = []
+    {
+        std::vector<std::string> p;
+        std::vector<std::shared_ptr<cache_data>> values;
+        for (std::int64_t key = 0; key < 256; ++key)
+        {
+            p.push_back(std::format("/usr/share/icons/hicolor/48x48/apps/{}.png", key));
+            values.push_back(
+                c.create(std::filesystem::path(p.back()),
+                         [key] { return std::make_shared<cache_data>(key); }));
+        }
+        return std::pair(p, values);
+    }();
+
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        const std::string_view path = paths.first[i++ % paths.first.size()];
+        if constexpr (requires { c.at(path); })
+        {
+            benchmark::DoNotOptimize(c.at(path));
+        }
+        else
+        {
+            benchmark::DoNotOptimize(c.at(std::filesystem::path(path)));
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+using path_cache = ztd::smart_cache<std::filesystem::path, cache_data>;
+using path_cache_transparent =
+    ztd::smart_cache<std::filesystem::path, cache_data, ztd::string_hash, ztd::string_equal>;
+
+template<std::size_t Shards>
+static void
+BM_create_hit(benchmark::State& state)
+{
+    auto& c = cache<Shards>();
+    auto key = std::int64_t(state.thread_index()) * 7919;
+    for (auto _ : state)
+    {
+        const auto k = key % key_count;
+        benchmark::DoNotOptimize(c.create(k, [k] { return std::make_shared<cache_data>(k); }));
+        key += 1;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template<std::size_t Shards>
+static void
+BM_create_hit_function(benchmark::State& state)
+{
+    auto& c = cache<Shards>();
+    auto key = std::int64_t(state.thread_index()) * 7919;
+    // with the key, too large for the small buffer of std::function
+    const std::string_view tag = "tag";
+    for (auto _ : state)
+    {
+        const auto k = key % key_count;
+        const std::function<std::shared_ptr<cache_data>()> creator = [k, tag]
+        { return std::make_shared<cache_data>(k + std::int64_t(tag.size())); };
+        benchmark::DoNotOptimize(c.create(k, creator));
+        key += 1;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template<std::size_t Shards>
+static void
+BM_create_hit_lambda(benchmark::State& state)
+{
+    auto& c = cache<Shards>();
+    auto key = std::int64_t(state.thread_index()) * 7919;
+    // with the key, too large for the small buffer of std::function
+    const std::string_view tag = "tag";
+    for (auto _ : state)
+    {
+        const auto k = key % key_count;
+        const auto creator = [k, tag]
+        { return std::make_shared<cache_data>(k + std::int64_t(tag.size())); };
+        benchmark::DoNotOptimize(c.create(k, creator));
+        key += 1;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template<std::size_t Shards>
+static void
+BM_create_erase(benchmark::State& state)
+{
+    // every thread writes its own keys, so only the lock is shared
+    static cache_type c(Shards);
+    const auto first = std::int64_t(state.thread_index()) * key_count;
+    auto key = first;
+    for (auto _ : state)
+    {
+        auto value = c.create(key, [&key] { return std::make_shared<cache_data>(key); });
+        benchmark::DoNotOptimize(value);
+        c.erase(key);
+        key = (key + 1 == first + key_count) ? first : key + 1;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_at<1>)->ThreadRange(1, 64)->UseRealTime();
+BENCHMARK(BM_at<cache_type::default_shards>)->ThreadRange(1, 64)->UseRealTime();
+BENCHMARK(BM_at<64>)->ThreadRange(1, 64)->UseRealTime();
+
+BENCHMARK(BM_at_bounded<ztd::cache_eviction::lru>)->ThreadRange(1, 64)->UseRealTime();
+BENCHMARK(BM_at_bounded<ztd::cache_eviction::clock>)->ThreadRange(1, 64)->UseRealTime();
+BENCHMARK(BM_at_bounded<ztd::cache_eviction::tinylfu>)->ThreadRange(1, 64)->UseRealTime();
+
+BENCHMARK(BM_at_path<path_cache>);
+BENCHMARK(BM_at_path<path_cache_transparent>);
+
+BENCHMARK(BM_create_hit<1>)->ThreadRange(1, 64)->UseRealTime();
+BENCHMARK(BM_create_hit<cache_type::default_shards>)->ThreadRange(1, 64)->UseRealTime();
+
+BENCHMARK(BM_create_hit_function<cache_type::default_shards>)->ThreadRange(1, 64)->UseRealTime();
+BENCHMARK(BM_create_hit_lambda<cache_type::default_shards>)->ThreadRange(1, 64)->UseRealTime();
+
+BENCHMARK(BM_create_erase<1>)->ThreadRange(1, 64)->UseRealTime();
+BENCHMARK(BM_create_erase<cache_type::default_shards>)->ThreadRange(1, 64)->UseRealTime();
+BENCHMARK(BM_create_erase<64>)->ThreadRange(1, 64)->UseRealTime();
@@ -0,0 +1,382 @@
+/**
+ * Copyright (C) 2025 Brandon Zorn <brandonzorn@cock.li>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <optional>
+#include <random>
+#include <vector>
+
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+
+#include "ztd/ztd.hxx"
+
+/**
+ *
+ * Benchmarks
+ *
+ * Each ztd::integer benchmark has a raw std::int64_t/std::uint64_t twin doing
+ * the same work with the compiler builtins, the difference is the wrapper overhead.
+ *
+ */
+
+static constexpr std::size_t input_size = 4096;
+
+/**
+ * @return input_size values, small enough that add/sub/mul never overflow
+ */
+template<typename T>
+static const std::vector<T>&
+inputs() noexcept
+{
+    static const std::vector<T> values = []
+    {
+        std::mt19937_64 rng(42);
+        std::uniform_int_distribution<T> dist(1, 1 << 20);
+
+        std::vector<T> v;
+        v.reserve(input_size);
+        for (std::size_t i = 0; i < input_size; ++i)
+        {
+            v.push_back(dist(rng));
+        }
+        return v;
+    }();
+    return values;
+}
+
+template<typename Integer>
+static const std::vector<Integer>&
+integer_inputs() noexcept
+{
+    static const std::vector<Integer> values = []
+    {
+        std::vector<Integer> v;
+        v.reserve(input_size);
+        for (const auto x : inputs<typename Integer::integer_type>())
+        {
+            v.push_back(Integer(x));
+        }
+        return v;
+    }();
+    return values;
+}
+
+/**
+ * @brief run a binary op over every adjacent pair of values
+ */
+template<typename T, typename Op>
+static void
+run_binary(benchmark::State& state, const std::vector<T>& values, Op op)
+{
+    for (auto _ : state)
+    {
+        for (std::size_t i = 1; i < values.size(); ++i)
+        {
+            benchmark::DoNotOptimize(op(values[i - 1], values[i]));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * std::int64_t(values.size() - 1));
+}
+
+/**
+ * @brief run a unary op over every value
+ */
+template<typename T, typename Op>
+static void
+run_unary(benchmark::State& state, const std::vector<T>& values, Op op)
+{
+    for (auto _ : state)
+    {
+        for (const auto x : values)
+        {
+            benchmark::DoNotOptimize(op(x));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * std::int64_t(values.size()));
+}
+
+template<typename T>
+static void
+BM_raw_wrapping(benchmark::State& state)
+{
+    run_binary(state,
+               inputs<T>(),
+               [](const T a, const T b)
+               {
+                   T r;
+                   (void)__builtin_add_overflow(a, b, &r);
+                   return r;
+               });
+}
+
+template<typename T>
+static void
+BM_raw_checked(benchmark::State& state)
+{
+    run_binary(state,
+               inputs<T>(),
+               [](const T a, const T b) -> std::optional<T>
+               {
+                   T r;
+                   if (__builtin_add_overflow(a, b, &r))
+                   {
+                       return std::nullopt;
+                   }
+                   return r;
+               });
+}
+
+template<typename T>
+static void
+BM_raw_saturating(benchmark::State& state)
+{
+    run_binary(state,
+               inputs<T>(),
+               [](const T a, const T b) { return std::saturating_add(a, b); });
+}
+
+template<typename T>
+static void
+BM_raw_mul(benchmark::State& state)
+{
+    run_binary(state, inputs<T>(), [](const T a, const T b) { return T(a * b); });
+}
+
+template<typename T>
+static void
+BM_raw_div(benchmark::State& state)
+{
+    run_binary(state, inputs<T>(), [](const T a, const T b) { return T(a / b); });
+}
+
+template<typename Integer>
+static void
+BM_integer_strict(benchmark::State& state)
+{
+    run_binary(state,
+               integer_inputs<Integer>(),
+               [](const Integer a, const Integer b) { return a.strict_add(b); });
+}
+
+template<typename Integer>
+static void
+BM_integer_checked(benchmark::State& state)
+{
+    run_binary(state,
+               integer_inputs<Integer>(),
+               [](const Integer a, const Integer b) { return a.checked_add(b); });
+}
+
+template<typename Integer>
+static void
+BM_integer_saturating(benchmark::State& state)
+{
+    run_binary(state,
+               integer_inputs<Integer>(),
+               [](const Integer a, const Integer b) { return a.saturating_add(b); });
+}
+
+template<typename Integer>
+static void
+BM_integer_wrapping(benchmark::State& state)
+{
+    run_binary(state,
+               integer_inputs<Integer>(),
+               [](const Integer a, const Integer b) { return a.wrapping_add(b); });
+}
+
+template<typename Integer>
+static void
+BM_integer_overflowing(benchmark::State& state)
+{
+    run_binary(state,
+               integer_inputs<Integer>(),
+               [](const Integer a, const Integer b) { return a.overflowing_add(b); });
+}
+
+template<typename Integer>
+static void
+BM_integer_mul(benchmark::State& state)
+{
+    run_binary(state,
+               integer_inputs<Integer>(),
+               [](const Integer a, const Integer b) { return a * b; });
+}
+
+template<typename Integer>
+static void
+BM_integer_div(benchmark::State& state)
+{
+    run_binary(state,
+               integer_inputs<Integer>(),
+               [](const Integer a, const Integer b) { return a / b; });
+}
+
+template<typename Integer>
+static void
+BM_integer_div_floor(benchmark::State& state)
+{
+    run_binary(state,
+               integer_inputs<Integer>(),
+               [](const Integer a, const Integer b) { return a.div_floor(b); });
+}
+
+template<typename Integer>
+static void
+BM_integer_divider(benchmark::State& state)
+{
+    const auto divider = ztd::divider<Integer>(integer_inputs<Integer>()[0]);
+    run_unary(state, integer_inputs<Integer>(), [&](const Integer a) { return a / divider; });
+}
+
+BENCHMARK(BM_raw_wrapping<std::int64_t>);
+BENCHMARK(BM_raw_wrapping<std::uint64_t>);
+BENCHMARK(BM_integer_wrapping<ztd::i64>);
+BENCHMARK(BM_integer_wrapping<ztd::u64>);
+BENCHMARK(BM_integer_overflowing<ztd::i64>);
+BENCHMARK(BM_integer_overflowing<ztd::u64>);
+BENCHMARK(BM_integer_strict<ztd::i64>);
+BENCHMARK(BM_integer_strict<ztd::u64>);
+
+BENCHMARK(BM_raw_checked<std::int64_t>);
+BENCHMARK(BM_raw_checked<std::uint64_t>);
+BENCHMARK(BM_integer_checked<ztd::i64>);
+BENCHMARK(BM_integer_checked<ztd::u64>);
+
+BENCHMARK(BM_raw_saturating<std::int64_t>);
+BENCHMARK(BM_raw_saturating<std::uint64_t>);
+BENCHMARK(BM_integer_saturating<ztd::i64>);
+BENCHMARK(BM_integer_saturating<ztd::u64>);
+
+BENCHMARK(BM_raw_mul<std::int64_t>);
+BENCHMARK(BM_raw_mul<std::uint64_t>);
+BENCHMARK(BM_integer_mul<ztd::i64>);
+BENCHMARK(BM_integer_mul<ztd::u64>);
+
+BENCHMARK(BM_raw_div<std::int64_t>);
+BENCHMARK(BM_raw_div<std::uint64_t>);
+BENCHMARK(BM_integer_div<ztd::i64>);
+BENCHMARK(BM_integer_div<ztd::u64>);
+BENCHMARK(BM_integer_div_floor<ztd::i64>);
+BENCHMARK(BM_integer_divider<ztd::i64>);
+BENCHMARK(BM_integer_divider<ztd::u64>);
+
+/*
+ * bit ops
+ */
+static void
+BM_raw_bits(benchmark::State& state)
+{
+    run_unary(state,
+              inputs<std::uint64_t>(),
+              [](const std::uint64_t x)
+              {
+                  return std::popcount(x) + std::countl_zero(x) + std::countr_zero(x) +
+                         int(std::rotl(x, 7) ^ std::byteswap(x));
+              });
+}
+BENCHMARK(BM_raw_bits);
+
+static void
+BM_integer_bits(benchmark::State& state)
+{
+    run_unary(state,
+              integer_inputs<ztd::u64>(),
+              [](const ztd::u64 x)
+              {
+                  return x.count_ones().data() + x.leading_zeros().data() +
+                         x.trailing_zeros().data() +
+                         std::uint32_t((x.rotate_left(7_i32) ^ x.swap_bytes()).data());
+              });
+}
+BENCHMARK(BM_integer_bits);
+
+/*
+ * pow
+ */
+static void
+BM_raw_pow(benchmark::State& state)
+{
+    run_unary(state,
+              inputs<std::uint64_t>(),
+              [](const std::uint64_t x)
+              {
+                  std::uint64_t r = 1;
+                  for (std::uint32_t i = 0; i < 3; ++i)
+                  {
+                      r *= x;
+                  }
+                  return r;
+              });
+}
+BENCHMARK(BM_raw_pow);
+
+static void
+BM_integer_pow(benchmark::State& state)
+{
+    run_unary(state, integer_inputs<ztd::u64>(), [](const ztd::u64 x) { return x.pow(3_u32); });
+}
+BENCHMARK(BM_integer_pow);
+
+/*
+ * ilog
+ */
+static void
+BM_raw_ilog2(benchmark::State& state)
+{
+    run_unary(state,
+              inputs<std::uint64_t>(),
+              [](const std::uint64_t x) { return std::bit_width(x) - 1; });
+}
+BENCHMARK(BM_raw_ilog2);
+
+static void
+BM_integer_ilog2(benchmark::State& state)
+{
+    run_unary(state, integer_inputs<ztd::u64>(), [](const ztd::u64 x) { return x.ilog2(); });
+}
+BENCHMARK(BM_integer_ilog2);
+
+static void
+BM_integer_ilog10(benchmark::State& state)
+{
+    run_unary(state, integer_inputs<ztd::u64>(), [](const ztd::u64 x) { return x.ilog10(); });
+}
+BENCHMARK(BM_integer_ilog10);
+
+/*
+ * isqrt
+ */
+static void
+BM_raw_isqrt(benchmark::State& state)
+{
+    run_unary(state,
+              inputs<std::uint64_t>(),
+              [](const std::uint64_t x) { return std::uint64_t(std::sqrt(double(x))); });
+}
+BENCHMARK(BM_raw_isqrt);
+
+static void
+BM_integer_isqrt(benchmark::State& state)
+{
+    run_unary(state, integer_inputs<ztd::u64>(), [](const ztd::u64 x) { return x.isqrt(); });
+}
+BENCHMARK(BM_integer_isqrt);
@@ -0,0 +1,131 @@
+/**
+ * Copyright (C) 2025 Brandon Zorn <brandonzorn@cock.li>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <random>
+#include <span>
+#include <vector>
+
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+
+#include "ztd/ztd.hxx"
+
+/**
+ *
+ * Benchmarks
+ *
+ * Throughput of ztd::packed_integers, in bytes of uncompressed integers per
+ * second. The input is a monotonic column, like timestamps or inode numbers.
+ *
+ */
+
+static constexpr std::size_t input_size = 1 << 20;
+
+/**
+ * @return input_size increasing values, with random gaps of up to 1000
+ */
+template<typename Integer>
+static const std::vector<Integer>&
+inputs() noexcept
+{
+    static const std::vector<Integer> values = []
+    {
+        using type = typename Integer::integer_type;
+
+        std::mt19937_64 rng(42);
+        std::uniform_int_distribution<type> dist(0, 1000);
+
+        std::vector<Integer> v;
+        v.reserve(input_size);
+        type now = 0;
+        for (std::size_t i = 0; i < input_size; ++i)
+        {
+            now += dist(rng);
+            v.push_back(Integer(now));
+        }
+        return v;
+    }();
+    return values;
+}
+
+template<typename Integer, ztd::packing Mode>
+static void
+BM_encode(benchmark::State& state)
+{
+    const auto& values = inputs<Integer>();
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(ztd::packed_integers<Integer, Mode>::encode(values));
+    }
+    state.SetBytesProcessed(state.iterations() * std::int64_t(values.size() * sizeof(Integer)));
+}
+
+template<typename Integer, ztd::packing Mode>
+static void
+BM_decode(benchmark::State& state)
+{
+    const auto& values = inputs<Integer>();
+    const auto packed = ztd::packed_integers<Integer, Mode>::encode(values);
+
+    std::vector<Integer> out(values.size());
+    for (auto _ : state)
+    {
+        for (std::size_t block = 0; block < packed.blocks(); ++block)
+        {
+            const auto dst = std::span(out).subspan(block * packed.block_size);
+            benchmark::DoNotOptimize(packed.decode_block(block, dst));
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * std::int64_t(values.size() * sizeof(Integer)));
+    state.counters["ratio"] = double(values.size() * sizeof(Integer)) / double(packed.size_bytes());
+}
+
+template<typename Integer, ztd::packing Mode>
+static void
+BM_decode_random_block(benchmark::State& state)
+{
+    const auto& values = inputs<Integer>();
+    const auto packed = ztd::packed_integers<Integer, Mode>::encode(values);
+
+    std::mt19937_64 rng(42);
+    std::uniform_int_distribution<std::size_t> dist(0, packed.blocks() - 1);
+
+    std::vector<Integer> out(packed.block_size);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(packed.decode_block(dist(rng), out));
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            std::int64_t(packed.block_size * sizeof(Integer)));
+}
+
+BENCHMARK(BM_encode<ztd::u32, ztd::packing::frame_of_reference>);
+BENCHMARK(BM_encode<ztd::u32, ztd::packing::delta>);
+BENCHMARK(BM_encode<ztd::u64, ztd::packing::frame_of_reference>);
+BENCHMARK(BM_encode<ztd::u64, ztd::packing::delta>);
+
+BENCHMARK(BM_decode<ztd::u32, ztd::packing::frame_of_reference>);
+BENCHMARK(BM_decode<ztd::u32, ztd::packing::delta>);
+BENCHMARK(BM_decode<ztd::u64, ztd::packing::frame_of_reference>);
+BENCHMARK(BM_decode<ztd::u64, ztd::packing::delta>);
+
+BENCHMARK(BM_decode_random_block<ztd::u32, ztd::packing::frame_of_reference>);
+BENCHMARK(BM_decode_random_block<ztd::u64, ztd::packing::delta>);
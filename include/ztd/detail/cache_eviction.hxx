@@ -0,0 +1,451 @@
+/**
+ * Copyright (C) 2025 Brandon Zorn <brandonzorn@cock.li>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// The strongly referenced entries of a bounded ztd::smart_cache, the values
+// that are kept alive while nobody else holds them.
+//
+//   cache_eviction::lru     - evicts the least recently used entry. Every hit
+//                             reorders a list under a mutex.
+//   cache_eviction::clock   - second chance, an approximation of lru where a
+//                             hit only sets a flag, so hits never block.
+//   cache_eviction::tinylfu - W-TinyLFU, a small lru window in front of a
+//                             segmented lru. An entry leaving the window only
+//                             replaces an entry of the main area if it has
+//                             been used more often, going by a count-min
+//                             sketch of the recent accesses. Keeps a good hit
+//                             rate through scans and one-off keys.
+
+namespace ztd
+{
+enum class cache_eviction : std::uint8_t
+{
+    lru,
+    clock,
+    tinylfu,
+};
+
+namespace detail::cache
+{
+template<typename Hash, typename KeyEqual>
+concept is_transparent = requires {
+    typename Hash::is_transparent;
+    typename KeyEqual::is_transparent;
+};
+
+// K can look up a KType key without being converted first, or is KType
+template<typename K, typename KType, typename Hash, typename KeyEqual>
+concept is_lookup_key = std::same_as<K, KType> ||
+                        (is_transparent<Hash, KeyEqual> && std::invocable<const Hash&, const K&> &&
+                         std::constructible_from<KType, const K&>);
+
+// a callable that creates the value of a missing key
+template<typename Creator, typename VType>
+concept is_creator = std::invocable<Creator&> &&
+                     std::convertible_to<std::invoke_result_t<Creator&>, std::shared_ptr<VType>>;
+
+/**
+ * @brief frequency_sketch
+ *
+ *  - a count-min sketch of 4 bit counters, the estimated number of accesses
+ *    of a key. Every counter is halved after 10 accesses per counter, so that
+ *    old accesses fade out.
+ */
+class frequency_sketch final
+{
+  public:
+    explicit frequency_sketch(const std::size_t capacity) noexcept
+        : width_(std::bit_ceil(std::max(capacity, std::size_t(16)))),
+          shift_(64 - std::size_t(std::countr_zero(width_))), counters_(depth * width_, 0)
+    {
+    }
+
+    void
+    increment(const std::size_t hash) noexcept
+    {
+        for (std::size_t row = 0; row < depth; ++row)
+        {
+            auto& counter = this->counters_[this->index(hash, row)];
+            if (counter < max_count)
+            {
+                ++counter;
+            }
+        }
+
+        if (++this->additions_ == 10 * this->width_)
+        {
+            for (auto& counter : this->counters_)
+            {
+                counter /= 2;
+            }
+            this->additions_ /= 2;
+        }
+    }
+
+    [[nodiscard]] std::uint8_t
+    estimate(const std::size_t hash) const noexcept
+    {
+        std::uint8_t count = max_count;
+        for (std::size_t row = 0; row < depth; ++row)
+        {
+            count = std::min(count, this->counters_[this->index(hash, row)]);
+        }
+        return count;
+    }
+
+  private:
+    static constexpr std::size_t depth = 4;
+    static constexpr std::uint8_t max_count = 15;
+
+    [[nodiscard]] std::size_t
+    index(const std::size_t hash, const std::size_t row) const noexcept
+    {
+        // a different multiplier for every row, so that keys that collide in
+        // one row do not collide in the others
+        static constexpr std::array<std::uint64_t, depth> seeds{
+            0x9e3779b97f4a7c15,
+            0xbf58476d1ce4e5b9,
+            0x94d049bb133111eb,
+            0xc2b2ae3d27d4eb4f,
+        };
+        const auto h = (std::uint64_t(hash) + row) * seeds[row];
+        return (row * this->width_) + std::size_t(h >> this->shift_);
+    }
+
+    std::size_t width_;
+    std::size_t shift_;
+    std::vector<std::uint8_t> counters_;
+    std::size_t additions_ = 0;
+};
+
+/**
+ * @brief resident
+ *
+ *  - the strongly referenced entries of one shard, at most capacity of them.
+ *    insert(), erase() and clear() need the unique lock of the shard, touch()
+ *    only the shared lock.
+ */
+template<typename KType, typename VType, typename Hash, typename KeyEqual> class resident final
+{
+  public:
+    resident(const std::size_t capacity, const cache_eviction eviction) noexcept
+        : eviction_(eviction), capacity_(std::max(capacity, std::size_t(1))),
+          window_capacity_(eviction == cache_eviction::tinylfu
+                               ? std::max(this->capacity_ / 100, std::size_t(1))
+                               : this->capacity_),
+          protected_capacity_((this->capacity_ - this->window_capacity_) * 4 / 5),
+          sketch_(eviction == cache_eviction::tinylfu ? this->capacity_ : 0)
+    {
+    }
+
+    resident(const resident&) = delete;
+    resident& operator=(const resident&) = delete;
+    resident(resident&&) = delete;
+    resident& operator=(resident&&) = delete;
+
+    // a hit on key
+    template<typename K>
+    void
+    touch(const K& key) noexcept
+    {
+        if (this->eviction_ == cache_eviction::clock)
+        {
+            const auto it = this->index_.find(key);
+            if (it != this->index_.end())
+            {
+                it->second->referenced.store(true, std::memory_order_relaxed);
+            }
+            return;
+        }
+
+        std::scoped_lock lock(this->lock_);
+
+        if (this->eviction_ == cache_eviction::tinylfu)
+        {
+            this->sketch_.increment(this->index_.hash_function()(key));
+        }
+
+        const auto it = this->index_.find(key);
+        if (it == this->index_.end())
+        {
+            return;
+        }
+        const auto entry = it->second;
+
+        switch (entry->where)
+        {
+            case area::window:
+                this->window_.splice(this->window_.begin(), this->window_, entry);
+                break;
+            case area::probation:
+                // a second hit, promote it
+                entry->where = area::protect;
+                this->protected_.splice(this->protected_.begin(), this->probation_, entry);
+                if (this->protected_.size() > this->protected_capacity_)
+                {
+                    const auto demoted = std::prev(this->protected_.end());
+                    demoted->where = area::probation;
+                    this->probation_.splice(this->probation_.begin(), this->protected_, demoted);
+                }
+                break;
+            case area::protect:
+                this->protected_.splice(this->protected_.begin(), this->protected_, entry);
+                break;
+        }
+    }
+
+    /**
+     * @brief insert
+     *
+     *  - add a new value, which can push out another value
+     *
+     * @return the evicted value, to be destroyed after the lock is released,
+     * or nullptr if nothing was evicted
+     */
+    [[nodiscard]] std::shared_ptr<VType>
+    insert(const KType& key, std::shared_ptr<VType> value) noexcept
+    {
+        const auto it = this->index_.find(key);
+        if (it != this->index_.end())
+        { // replaced, not evicted
+            return std::exchange(it->second->value, std::move(value));
+        }
+
+        std::shared_ptr<VType> evicted;
+
+        switch (this->eviction_)
+        {
+            case cache_eviction::lru:
+                this->window_.emplace_front(key, std::move(value), area::window);
+                this->index_.emplace(key, this->window_.begin());
+                if (this->window_.size() > this->capacity_)
+                {
+                    evicted = this->remove(std::prev(this->window_.end()));
+                }
+                break;
+            case cache_eviction::clock:
+                if (this->window_.size() == this->capacity_)
+                {
+                    evicted = this->remove(this->clock_victim());
+                }
+                // behind the hand, so that it is the last to be looked at
+                this->index_.emplace(
+                    key,
+                    this->window_.emplace(this->hand_, key, std::move(value), area::window));
+                break;
+            case cache_eviction::tinylfu:
+                this->sketch_.increment(this->index_.hash_function()(key));
+                this->window_.emplace_front(key, std::move(value), area::window);
+                this->index_.emplace(key, this->window_.begin());
+                if (this->window_.size() > this->window_capacity_)
+                {
+                    evicted = this->admit(std::prev(this->window_.end()));
+                }
+                break;
+        }
+
+        if (evicted != nullptr)
+        {
+            ++this->evictions_;
+        }
+        return evicted;
+    }
+
+    // @return the removed value, to be destroyed after the lock is released
+    template<typename K>
+    [[nodiscard]] std::shared_ptr<VType>
+    erase(const K& key) noexcept
+    {
+        const auto it = this->index_.find(key);
+        if (it == this->index_.end())
+        {
+            return nullptr;
+        }
+        return this->remove(it->second);
+    }
+
+    // @return the removed values, to be destroyed after the lock is released
+    [[nodiscard]] std::vector<std::shared_ptr<VType>>
+    clear() noexcept
+    {
+        std::vector<std::shared_ptr<VType>> values;
+        values.reserve(this->index_.size());
+        for (auto* segment : {&this->window_, &this->probation_, &this->protected_})
+        {
+            for (auto& entry : *segment)
+            {
+                values.push_back(std::move(entry.value));
+            }
+            segment->clear();
+        }
+        this->index_.clear();
+        this->hand_ = this->window_.end();
+        return values;
+    }
+
+    [[nodiscard]] std::size_t
+    size() const noexcept
+    {
+        return this->index_.size();
+    }
+
+    [[nodiscard]] std::uint64_t
+    evictions() const noexcept
+    {
+        return this->evictions_;
+    }
+
+  private:
+    enum class area : std::uint8_t
+    {
+        window,
+        probation,
+        protect,
+    };
+
+    struct node
+    {
+        node(const KType& k, std::shared_ptr<VType> v, const area a) noexcept
+            : key(k), value(std::move(v)), where(a)
+        {
+        }
+
+        KType key;
+        std::shared_ptr<VType> value;
+        area where;
+        // only used by cache_eviction::clock, set by touch() without the mutex
+        std::atomic<bool> referenced{false};
+    };
+
+    using list_type = std::list<node>;
+    using iterator = typename list_type::iterator;
+
+    [[nodiscard]] list_type&
+    list(const area a) noexcept
+    {
+        switch (a)
+        {
+            case area::window:
+                return this->window_;
+            case area::probation:
+                return this->probation_;
+            case area::protect:
+                return this->protected_;
+        }
+        return this->window_;
+    }
+
+    [[nodiscard]] std::shared_ptr<VType>
+    remove(const iterator entry) noexcept
+    {
+        if (entry == this->hand_)
+        {
+            this->hand_ = std::next(entry);
+        }
+        auto value = std::move(entry->value);
+        this->index_.erase(entry->key);
+        this->list(entry->where).erase(entry);
+        return value;
+    }
+
+    // advance the hand to the first entry that was not used since the last
+    // pass, giving every used entry a second chance
+    [[nodiscard]] iterator
+    clock_victim() noexcept
+    {
+        while (true)
+        {
+            if (this->hand_ == this->window_.end())
+            {
+                this->hand_ = this->window_.begin();
+            }
+            if (!this->hand_->referenced.exchange(false, std::memory_order_relaxed))
+            {
+                return this->hand_;
+            }
+            ++this->hand_;
+        }
+    }
+
+    // the candidate leaves the window, either it or the next victim of the
+    // main area is evicted
+    [[nodiscard]] std::shared_ptr<VType>
+    admit(const iterator candidate) noexcept
+    {
+        const auto main_capacity = this->capacity_ - this->window_capacity_;
+        if (this->probation_.size() + this->protected_.size() < main_capacity)
+        {
+            candidate->where = area::probation;
+            this->probation_.splice(this->probation_.begin(), this->window_, candidate);
+            return nullptr;
+        }
+
+        auto& victims = this->probation_.empty() ? this->protected_ : this->probation_;
+        if (victims.empty())
+        { // no main area at all
+            return this->remove(candidate);
+        }
+        const auto victim = std::prev(victims.end());
+
+        const auto& hash = this->index_.hash_function();
+        const auto candidate_count = this->sketch_.estimate(hash(candidate->key));
+        if (candidate_count <= this->sketch_.estimate(hash(victim->key)))
+        {
+            return this->remove(candidate);
+        }
+
+        auto evicted = this->remove(victim);
+        candidate->where = area::probation;
+        this->probation_.splice(this->probation_.begin(), this->window_, candidate);
+        return evicted;
+    }
+
+    cache_eviction eviction_;
+    std::size_t capacity_;
+    std::size_t window_capacity_;
+    std::size_t protected_capacity_;
+
+    // lru and clock only use the window
+    list_type window_;
+    list_type probation_;
+    list_type protected_;
+    std::unordered_map<KType, iterator, Hash, KeyEqual> index_;
+    iterator hand_ = window_.end();
+
+    // the order of the lists is changed by touch() under the shared lock
+    std::mutex lock_;
+    frequency_sketch sketch_;
+    std::uint64_t evictions_ = 0;
+};
+} // namespace detail::cache
+} // namespace ztd
@@ -0,0 +1,345 @@
+/**
+ * Copyright (C) 2025 Brandon Zorn <brandonzorn@cock.li>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <charconv>
+#include <limits>
+#include <system_error>
+#include <tuple>
+#include <type_traits>
+
+#include <cstdint>
+#include <cstring>
+
+#include "concepts.hxx"
+
+// Integer parsing and formatting with the same contract as std::from_chars
+// and std::to_chars, limited to base 10 and base 16.
+//
+// Decimal parsing consumes 8 digits per step using SWAR (SIMD within a register),
+// decimal formatting emits 2 digits per step from a lookup table.
+
+namespace ztd::detail::charconv
+{
+// clang-format off
+inline constexpr std::array<char, 200> digit_pairs{
+    '0','0','0','1','0','2','0','3','0','4','0','5','0','6','0','7','0','8','0','9',
+    '1','0','1','1','1','2','1','3','1','4','1','5','1','6','1','7','1','8','1','9',
+    '2','0','2','1','2','2','2','3','2','4','2','5','2','6','2','7','2','8','2','9',
+    '3','0','3','1','3','2','3','3','3','4','3','5','3','6','3','7','3','8','3','9',
+    '4','0','4','1','4','2','4','3','4','4','4','5','4','6','4','7','4','8','4','9',
+    '5','0','5','1','5','2','5','3','5','4','5','5','5','6','5','7','5','8','5','9',
+    '6','0','6','1','6','2','6','3','6','4','6','5','6','6','6','7','6','8','6','9',
+    '7','0','7','1','7','2','7','3','7','4','7','5','7','6','7','7','7','8','7','9',
+    '8','0','8','1','8','2','8','3','8','4','8','5','8','6','8','7','8','8','8','9',
+    '9','0','9','1','9','2','9','3','9','4','9','5','9','6','9','7','9','8','9','9',
+};
+// clang-format on
+
+inline constexpr std::array<char, 16> hex_digits{
+    '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'};
+
+inline constexpr std::array<std::uint64_t, 20> powers_of_10{
+    1ull,
+    10ull,
+    100ull,
+    1000ull,
+    10000ull,
+    100000ull,
+    1000000ull,
+    10000000ull,
+    100000000ull,
+    1000000000ull,
+    10000000000ull,
+    100000000000ull,
+    1000000000000ull,
+    10000000000000ull,
+    100000000000000ull,
+    1000000000000000ull,
+    10000000000000000ull,
+    100000000000000000ull,
+    1000000000000000000ull,
+    10000000000000000000ull,
+};
+
+/**
+ * @return the numeric value of c in base 16, or a value >= 16 if c is not a hex digit
+ */
+[[nodiscard]] constexpr std::uint32_t
+hex_value(const char c) noexcept
+{
+    const auto d = static_cast<std::uint32_t>(static_cast<unsigned char>(c) - '0');
+    if (d < 10)
+    {
+        return d;
+    }
+    // fold to lowercase, 'a'..'f' maps to 10..15
+    const auto l = static_cast<std::uint32_t>((static_cast<unsigned char>(c) | 0x20u) - 'a');
+    return l < 6 ? l + 10 : 16;
+}
+
+/**
+ * @return 8 bytes starting at ptr, the first byte in the least significant position
+ */
+[[nodiscard]] constexpr std::uint64_t
+load_u64(const char* ptr) noexcept
+{
+    std::uint64_t word = 0;
+    if consteval
+    {
+        for (std::size_t i = 0; i < 8; ++i)
+        {
+            word |= std::uint64_t(static_cast<unsigned char>(ptr[i])) << (i * 8);
+        }
+    }
+    else
+    {
+        std::memcpy(&word, ptr, sizeof(word));
+        if constexpr (std::endian::native == std::endian::big)
+        {
+            word = std::byteswap(word);
+        }
+    }
+    return word;
+}
+
+/**
+ * @return true if all 8 bytes in word are ascii digits
+ */
+[[nodiscard]] constexpr bool
+is_eight_digits(const std::uint64_t word) noexcept
+{
+    return ((word & 0xF0F0F0F0F0F0F0F0) |
+            (((word + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) >> 4)) == 0x3333333333333333;
+}
+
+/**
+ * @return the value of 8 ascii digits, the first digit being the most significant
+ */
+[[nodiscard]] constexpr std::uint32_t
+parse_eight_digits(std::uint64_t word) noexcept
+{
+    word -= 0x3030303030303030;
+    word = (word * 10) + (word >> 8);
+    word = (((word & 0x000000FF000000FF) * (100 + (1000000ull << 32))) +
+            (((word >> 16) & 0x000000FF000000FF) * (1 + (10000ull << 32)))) >>
+           32;
+    return static_cast<std::uint32_t>(word);
+}
+
+/**
+ * @return the number of base 10 digits needed to represent v
+ */
+[[nodiscard]] constexpr std::uint32_t
+count_digits(const std::uint64_t v) noexcept
+{
+    // approximate log10 from log2, then correct by one
+    const auto guess = (static_cast<std::uint32_t>(std::bit_width(v)) * 1233) >> 12;
+    return guess + (v >= powers_of_10[guess] ? 1 : 0) + (v == 0 ? 1 : 0);
+}
+
+/**
+ * @return the number of base 16 digits needed to represent v
+ */
+[[nodiscard]] constexpr std::uint32_t
+count_hex_digits(const std::uint64_t v) noexcept
+{
+    return std::max(1u, (static_cast<std::uint32_t>(std::bit_width(v)) + 3) / 4);
+}
+
+/**
+ * @brief parse_unsigned - parse the digits at [first, last) into a std::uint64_t
+ *
+ * @return the end of the digits, and if the value does not fit in a std::uint64_t
+ */
+[[nodiscard]] constexpr std::tuple<const char*, std::uint64_t, bool>
+parse_unsigned(const char* first, const char* last, const int base) noexcept
+{
+    std::uint64_t value = 0;
+    bool overflow = false;
+    const char* ptr = first;
+
+    if (base == 10)
+    {
+        while (last - ptr >= 8)
+        {
+            const auto word = load_u64(ptr);
+            if (!is_eight_digits(word))
+            {
+                break;
+            }
+            overflow |= __builtin_mul_overflow(value, std::uint64_t(100000000), &value);
+            overflow |= __builtin_add_overflow(value, parse_eight_digits(word), &value);
+            ptr += 8;
+        }
+
+        for (; ptr != last; ++ptr)
+        {
+            const auto d = static_cast<std::uint32_t>(static_cast<unsigned char>(*ptr) - '0');
+            if (d >= 10)
+            {
+                break;
+            }
+            overflow |= __builtin_mul_overflow(value, std::uint64_t(10), &value);
+            overflow |= __builtin_add_overflow(value, d, &value);
+        }
+    }
+    else
+    {
+        for (; ptr != last; ++ptr)
+        {
+            const auto d = hex_value(*ptr);
+            if (d >= 16)
+            {
+                break;
+            }
+            overflow |= (value >> 60) != 0;
+            value = (value << 4) | d;
+        }
+    }
+
+    return {ptr, value, overflow};
+}
+
+/**
+ * @brief from_chars - std::from_chars for base 10 and base 16
+ */
+template<typename T>
+[[nodiscard]] constexpr std::from_chars_result
+from_chars(const char* first, const char* last, T& result, const int base = 10) noexcept
+    requires(is_integer<T>)
+{
+    using unsigned_type = std::make_unsigned_t<T>;
+
+    if (base != 10 && base != 16)
+    {
+        return {first, std::errc::invalid_argument};
+    }
+
+    const char* ptr = first;
+    bool negative = false;
+    if constexpr (is_signed_integer<T>)
+    {
+        if (ptr != last && *ptr == '-')
+        {
+            negative = true;
+            ++ptr;
+        }
+    }
+
+    const auto [end, value, overflow] = parse_unsigned(ptr, last, base);
+    if (end == ptr)
+    {
+        return {first, std::errc::invalid_argument};
+    }
+
+    // the magnitude of MIN is one larger than MAX
+    const auto limit =
+        static_cast<std::uint64_t>(std::numeric_limits<T>::max()) + (negative ? 1u : 0u);
+    if (overflow || value > limit)
+    {
+        return {end, std::errc::result_out_of_range};
+    }
+
+    if (negative)
+    {
+        result = static_cast<T>(unsigned_type(0) - static_cast<unsigned_type>(value));
+    }
+    else
+    {
+        result = static_cast<T>(value);
+    }
+    return {end, std::errc()};
+}
+
+/**
+ * @brief to_chars - std::to_chars for base 10 and base 16
+ */
+template<typename T>
+[[nodiscard]] constexpr std::to_chars_result
+to_chars(char* first, char* last, const T value, const int base = 10) noexcept
+    requires(is_integer<T>)
+{
+    if (base != 10 && base != 16)
+    {
+        return {last, std::errc::invalid_argument};
+    }
+
+    std::uint64_t magnitude = 0;
+    bool negative = false;
+    if constexpr (is_signed_integer<T>)
+    {
+        negative = value < 0;
+        using unsigned_type = std::make_unsigned_t<T>;
+        const auto u = static_cast<unsigned_type>(value);
+        magnitude = negative ? static_cast<unsigned_type>(unsigned_type(0) - u) : u;
+    }
+    else
+    {
+        magnitude = value;
+    }
+
+    const auto digits = base == 10 ? count_digits(magnitude) : count_hex_digits(magnitude);
+
+    if (last - first < std::ptrdiff_t(digits + (negative ? 1 : 0)))
+    {
+        return {last, std::errc::value_too_large};
+    }
+
+    if (negative)
+    {
+        *first++ = '-';
+    }
+
+    char* end = first + digits;
+    char* ptr = end;
+    if (base == 10)
+    {
+        while (magnitude >= 100)
+        {
+            const auto idx = (magnitude % 100) * 2;
+            magnitude /= 100;
+            *--ptr = digit_pairs[idx + 1];
+            *--ptr = digit_pairs[idx];
+        }
+        if (magnitude >= 10)
+        {
+            const auto idx = magnitude * 2;
+            *--ptr = digit_pairs[idx + 1];
+            *--ptr = digit_pairs[idx];
+        }
+        else
+        {
+            *--ptr = static_cast<char>('0' + magnitude);
+        }
+    }
+    else
+    {
+        do
+        {
+            *--ptr = hex_digits[magnitude & 0xF];
+            magnitude >>= 4;
+        } while (magnitude != 0);
+    }
+
+    return {end, std::errc()};
+}
+} // namespace ztd::detail::charconv
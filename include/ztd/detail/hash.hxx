@@ -0,0 +1,90 @@
+/**
+ * Copyright (C) 2025 Brandon Zorn <brandonzorn@cock.li>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <filesystem>
+#include <functional>
+#include <string_view>
+
+// Transparent hash and equality for string keys, so that a container keyed by
+// std::string or std::filesystem::path can be searched with a std::string_view,
+// a const char* or a path without building a key first.
+//
+//   std::unordered_map<std::string, T, ztd::string_hash, ztd::string_equal> map;
+//   map.find(std::string_view("key"));
+//
+// A path is compared by its native string, not component wise as by
+// std::filesystem::path::operator==, so "a//b" and "a/b" are different keys.
+
+namespace ztd
+{
+namespace detail::hash
+{
+template<typename T>
+concept is_string_like = std::convertible_to<const T&, std::string_view>;
+
+[[nodiscard]] inline std::string_view
+view(const std::filesystem::path& path) noexcept
+{
+    return path.native();
+}
+
+template<typename T>
+[[nodiscard]] constexpr std::string_view
+view(const T& str) noexcept
+    requires(is_string_like<T>)
+{
+    return str;
+}
+} // namespace detail::hash
+
+struct string_hash final
+{
+    using is_transparent = void;
+
+    template<typename T>
+    [[nodiscard]] std::size_t
+    operator()(const T& str) const noexcept
+        requires(detail::hash::is_string_like<T>)
+    {
+        return std::hash<std::string_view>{}(detail::hash::view(str));
+    }
+
+    [[nodiscard]] std::size_t
+    operator()(const std::filesystem::path& path) const noexcept
+    {
+        return std::hash<std::string_view>{}(detail::hash::view(path));
+    }
+};
+
+struct string_equal final
+{
+    using is_transparent = void;
+
+    template<typename L, typename R>
+    [[nodiscard]] bool
+    operator()(const L& lhs, const R& rhs) const noexcept
+        requires((detail::hash::is_string_like<L> || std::same_as<L, std::filesystem::path>) &&
+                 (detail::hash::is_string_like<R> || std::same_as<R, std::filesystem::path>))
+    {
+        return detail::hash::view(lhs) == detail::hash::view(rhs);
+    }
+};
+} // namespace ztd
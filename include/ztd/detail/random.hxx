@@ -17,25 +17,221 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <exception>
 #include <limits>
 #include <random>
 #include <type_traits>
 
 #include "concepts.hxx"
 #include "panic.hxx"
+#include "random_engine.hxx"
 
 namespace ztd
 {
 namespace detail
 {
-inline std::mt19937&
+// 64 bits from the OS, one syscall. std::random_device throws if there is no
+// entropy source, then the clock and a stack address are mixed instead, which
+// is still a distinct seed per run for a non cryptographic engine.
+[[nodiscard]] inline std::uint64_t
+entropy() noexcept
+{
+    try
+    {
+        std::random_device rd;
+        return (std::uint64_t(rd()) << 32) | std::uint64_t(rd());
+    }
+    catch (const std::exception&)
+    {
+        auto state = std::uint64_t(std::chrono::steady_clock::now().time_since_epoch().count());
+        state ^= std::uint64_t(reinterpret_cast<std::uintptr_t>(&state));
+        return prng::splitmix64(state);
+    }
+}
+
+inline xoshiro256pp&
 rng()
 {
-    static thread_local std::mt19937 rng(std::random_device{}());
+    // Only the first thread pays for std::random_device, the others get a
+    // distinct seed derived from it.
+    static const std::uint64_t process_seed = entropy();
+    static std::atomic<std::uint64_t> threads = 0;
+    static thread_local xoshiro256pp rng(
+        []
+        {
+            auto seed = process_seed + threads.fetch_add(1, std::memory_order_relaxed);
+            return prng::splitmix64(seed);
+        }());
     return rng;
 }
+
+namespace prng
+{
+// The engine for stream index of seed. Streams of engines with a jump ahead
+// never overlap, the others are seeded from a hash of (seed, index).
+//
+// xoshiro256pp has no jump by an arbitrary distance, stream index takes index
+// jump() calls of 256 draws each, so it is O(index).
+template<typename Engine>
+[[nodiscard]] constexpr Engine
+make_stream(const std::uint64_t seed, std::uint64_t index) noexcept
+{
+    if constexpr (std::same_as<Engine, xoshiro256pp>)
+    {
+        Engine engine(seed);
+        for (; index != 0; --index)
+        {
+            engine.jump();
+        }
+        return engine;
+    }
+    else if constexpr (std::same_as<Engine, pcg64>)
+    {
+        return Engine(seed, index);
+    }
+    else
+    {
+        auto mixed = splitmix64(index) ^ seed;
+        return Engine(typename Engine::result_type(splitmix64(mixed)));
+    }
+}
+} // namespace prng
 } // namespace detail
 
+/**
+ * @brief random_context
+ *
+ *  - an explicit, seedable engine for the ztd::random functions, so that a
+ *    run can be reproduced from its seed. Each worker of a parallel job
+ *    should draw from its own stream(i) instead of sharing one context.
+ *
+ *  - Engine is any 64 bit engine, i.e. ztd::xoshiro256pp (the default),
+ *    ztd::pcg64, ztd::wyrand or std::mt19937_64
+ */
+template<typename Engine = xoshiro256pp>
+    requires(detail::prng::is_engine64<Engine>)
+class random_context final
+{
+  public:
+    using engine_type = Engine;
+    using result_type = typename Engine::result_type;
+
+    /**
+     * @brief random_context - seeded from std::random_device, or from the
+     * clock if it is not available
+     */
+    random_context() noexcept : random_context(detail::entropy()) {}
+
+    /**
+     * @brief random_context - the same seed always gives the same draws
+     * @param[in] seed The seed of stream 0
+     */
+    constexpr explicit random_context(const std::uint64_t seed) noexcept
+        : random_context(seed, 0)
+    {
+    }
+
+    /**
+     * @brief stream
+     *
+     *  - a context for stream index of the same seed, i.e. one per worker
+     *    thread. Distinct indices give independent streams, and the same
+     *    (seed, index) always gives the same draws.
+     *
+     *  - with xoshiro256pp this costs O(index), index jumps of 256 draws each.
+     *    It is meant for one stream per worker, not for a large index.
+     *
+     * @param[in] index The stream index, 0 is the stream of this seed
+     * @return a new context at the start of the stream
+     */
+    [[nodiscard]] constexpr random_context
+    stream(const std::uint64_t index) const noexcept
+    {
+        return random_context(this->seed_, index);
+    }
+
+    [[nodiscard]] constexpr std::uint64_t
+    seed() const noexcept
+    {
+        return this->seed_;
+    }
+
+    [[nodiscard]] constexpr std::uint64_t
+    stream_index() const noexcept
+    {
+        return this->stream_index_;
+    }
+
+    [[nodiscard]] constexpr Engine&
+    engine() noexcept
+    {
+        return this->engine_;
+    }
+
+    [[nodiscard]] static constexpr result_type
+    min() noexcept
+    {
+        return Engine::min();
+    }
+
+    [[nodiscard]] static constexpr result_type
+    max() noexcept
+    {
+        return Engine::max();
+    }
+
+    constexpr result_type
+    operator()() noexcept
+    {
+        return this->engine_();
+    }
+
+  private:
+    constexpr random_context(const std::uint64_t seed, const std::uint64_t index) noexcept
+        : seed_(seed), stream_index_(index),
+          engine_(detail::prng::make_stream<Engine>(seed, index))
+    {
+    }
+
+    std::uint64_t seed_;
+    std::uint64_t stream_index_;
+    Engine engine_;
+};
+
+/**
+ *  @brief rand
+ *
+ *  - get a random integral of type T between (min, max)
+ *
+ * @param[in,out] context The context to draw from, i.e. a ztd::random_context
+ * @param[in] min min random value
+ * @param[in] max max random value
+ *
+ * @return a random integral
+ */
+template<typename T, typename Context>
+[[nodiscard]] inline T
+random(Context& context,
+       const T min = std::numeric_limits<T>::min(),
+       const T max = std::numeric_limits<T>::max()) noexcept
+    requires(detail::is_integer<T> && detail::prng::is_engine64<Context>)
+{
+    ztd::panic_if(min > max);
+
+    using unsigned_type = std::make_unsigned_t<T>;
+
+    const auto range = std::uint64_t(unsigned_type(unsigned_type(max) - unsigned_type(min)));
+    if (range == std::numeric_limits<std::uint64_t>::max())
+    {
+        return T(context());
+    }
+    return T(unsigned_type(unsigned_type(min) +
+                           unsigned_type(detail::prng::bounded(context, range + 1))));
+}
+
 /**
  *  @brief rand
  *
@@ -51,11 +247,32 @@ template<typename T>
 random(const T min = std::numeric_limits<T>::min(),
        const T max = std::numeric_limits<T>::max()) noexcept
     requires(detail::is_integer<T>)
+{
+    return ztd::random<T>(detail::rng(), min, max);
+}
+
+/**
+ *  @brief rand
+ *
+ *  - get a random floating point of type T between (min, max)
+ *
+ * @param[in,out] context The context to draw from, i.e. a ztd::random_context
+ * @param[in] min min random value
+ * @param[in] max max random value
+ *
+ * @return a random floating point
+ */
+template<typename T, typename Context>
+[[nodiscard]] inline T
+random(Context& context,
+       const T min = std::numeric_limits<T>::lowest(),
+       const T max = std::numeric_limits<T>::max()) noexcept
+    requires(std::is_floating_point_v<T> && detail::prng::is_engine64<Context>)
 {
     ztd::panic_if(min > max);
 
-    std::uniform_int_distribution<T> dist(min, max);
-    return dist(detail::rng());
+    std::uniform_real_distribution<T> dist(min, max);
+    return dist(context);
 }
 
 /**
@@ -74,10 +291,24 @@ random(const T min = std::numeric_limits<T>::lowest(),
        const T max = std::numeric_limits<T>::max()) noexcept
     requires(std::is_floating_point_v<T>)
 {
-    ztd::panic_if(min > max);
+    return ztd::random<T>(detail::rng(), min, max);
+}
 
-    std::uniform_real_distribution<T> dist(min, max);
-    return dist(detail::rng());
+/**
+ *  @brief rand
+ *
+ *  - get a random bool
+ *
+ * @param[in,out] context The context to draw from, i.e. a ztd::random_context
+ *
+ * @return a random bool
+ */
+template<typename T, typename Context>
+[[nodiscard]] inline T
+random(Context& context) noexcept
+    requires(std::same_as<T, bool> && detail::prng::is_engine64<Context>)
+{
+    return (context() >> 63) != 0;
 }
 
 /**
@@ -92,7 +323,6 @@ template<typename T>
 random() noexcept
     requires(std::same_as<T, bool>)
 {
-    static thread_local std::bernoulli_distribution dist(0.5);
-    return dist(detail::rng());
+    return ztd::random<T>(detail::rng());
 }
 } // namespace ztd
@@ -0,0 +1,425 @@
+/**
+ * Copyright (C) 2025 Brandon Zorn <brandonzorn@cock.li>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+#include "panic.hxx"
+#include "random.hxx"
+
+// Batch samplers over std::span.
+//
+// The engines are a serial dependency chain, so each batch first draws a
+// block of raw words and then turns the whole block into values in a
+// separate, branch-free loop that the compiler can auto-vectorize. Doubles
+// are made from the top 52 bits of a word by setting the exponent of 1.0
+// instead of an integer to floating point conversion.
+
+namespace ztd
+{
+namespace detail::distribution
+{
+inline constexpr std::size_t block_size = 256;
+
+// [1, 2) from the top 52 bits
+[[nodiscard]] constexpr double
+one_two(const std::uint64_t bits) noexcept
+{
+    return std::bit_cast<double>((bits >> 12) | 0x3ff0000000000000);
+}
+
+// [0, 1)
+[[nodiscard]] constexpr double
+unit(const std::uint64_t bits) noexcept
+{
+    return one_two(bits) - 1.0;
+}
+
+// (0, 1), for the logarithms
+[[nodiscard]] constexpr double
+open_unit(const std::uint64_t bits) noexcept
+{
+    return one_two(bits) - (1.0 - 0x1.0p-53);
+}
+
+// [0, 1) as two floats from the two halves of a word
+[[nodiscard]] constexpr float
+unit_float(const std::uint32_t bits) noexcept
+{
+    return std::bit_cast<float>((bits >> 9) | 0x3f800000) - 1.0f;
+}
+
+template<typename Engine>
+inline void
+draw_block(const std::span<std::uint64_t> words, Engine& engine) noexcept
+{
+    for (auto& word : words)
+    {
+        word = engine();
+    }
+}
+
+// Marsaglia and Tsang's ziggurat with 256 layers of equal area. x[0] is the
+// width of the base layer (including the tail), x[1] = R and x[256] = 0.
+struct ziggurat
+{
+    std::array<double, 257> x;
+    std::array<double, 257> f;
+    double r;
+};
+
+template<typename Pdf, typename InversePdf>
+[[nodiscard]] inline ziggurat
+make_ziggurat(const double r, const double v, Pdf pdf, InversePdf inverse_pdf) noexcept
+{
+    ziggurat z{};
+    z.r = r;
+    z.x[0] = v / pdf(r);
+    z.x[1] = r;
+    for (std::size_t i = 1; i < 255; ++i)
+    {
+        z.x[i + 1] = inverse_pdf(std::min(1.0, pdf(z.x[i]) + v / z.x[i]));
+    }
+    z.x[256] = 0.0;
+    for (std::size_t i = 0; i < z.x.size(); ++i)
+    {
+        z.f[i] = pdf(z.x[i]);
+    }
+    return z;
+}
+
+[[nodiscard]] inline double
+normal_pdf(const double x) noexcept
+{
+    return std::exp(-x * x / 2.0);
+}
+
+[[nodiscard]] inline double
+exponential_pdf(const double x) noexcept
+{
+    return std::exp(-x);
+}
+
+[[nodiscard]] inline const ziggurat&
+normal_ziggurat() noexcept
+{
+    static const ziggurat z =
+        make_ziggurat(3.654152885361008796,
+                      0.00492867323399,
+                      normal_pdf,
+                      [](const double y) { return std::sqrt(-2.0 * std::log(y)); });
+    return z;
+}
+
+[[nodiscard]] inline const ziggurat&
+exponential_ziggurat() noexcept
+{
+    static const ziggurat z = make_ziggurat(7.697117470131049720,
+                                            0.0039496598225815571993,
+                                            exponential_pdf,
+                                            [](const double y) { return -std::log(y); });
+    return z;
+}
+
+// the slow path of a draw that was outside of its layer's rectangle
+template<bool Symmetric, typename Engine>
+[[nodiscard]] inline double
+ziggurat_retry(const ziggurat& z, std::uint64_t bits, Engine& engine) noexcept
+{
+    const auto pdf = Symmetric ? normal_pdf : exponential_pdf;
+    while (true)
+    {
+        const auto i = std::size_t(bits & 0xff);
+        const double u = Symmetric ? 2.0 * unit(bits) - 1.0 : unit(bits);
+        const double x = u * z.x[i];
+        const double ax = Symmetric ? std::abs(x) : x;
+        if (ax < z.x[i + 1])
+        {
+            return x;
+        }
+
+        if (i == 0)
+        {
+            // the tail past R
+            if constexpr (Symmetric)
+            {
+                while (true)
+                {
+                    const double tx = std::log(open_unit(engine())) / z.r;
+                    const double ty = std::log(open_unit(engine()));
+                    if (-2.0 * ty >= tx * tx)
+                    {
+                        return u < 0.0 ? tx - z.r : z.r - tx;
+                    }
+                }
+            }
+            else
+            {
+                return z.r - std::log(open_unit(engine()));
+            }
+        }
+
+        if (z.f[i + 1] + (z.f[i] - z.f[i + 1]) * unit(engine()) < pdf(ax))
+        {
+            return x;
+        }
+        bits = engine();
+    }
+}
+
+template<bool Symmetric, typename T, typename Engine>
+inline void
+fill_ziggurat(const std::span<T> out,
+              const ziggurat& z,
+              const double scale,
+              const double shift,
+              Engine& engine) noexcept
+{
+    std::array<std::uint64_t, block_size> words;
+    std::array<double, block_size> values;
+    std::array<bool, block_size> accepted;
+
+    for (std::size_t first = 0; first < out.size(); first += block_size)
+    {
+        const auto count = std::min(block_size, out.size() - first);
+        draw_block(std::span(words).first(count), engine);
+
+        // the fast path, about 99% of the draws land inside the rectangle
+        // of their layer
+        for (std::size_t k = 0; k < count; ++k)
+        {
+            const auto i = std::size_t(words[k] & 0xff);
+            const double u = Symmetric ? 2.0 * unit(words[k]) - 1.0 : unit(words[k]);
+            const double x = u * z.x[i];
+            values[k] = x;
+            accepted[k] = (Symmetric ? std::abs(x) : x) < z.x[i + 1];
+        }
+
+        for (std::size_t k = 0; k < count; ++k)
+        {
+            if (!accepted[k])
+            {
+                values[k] = ziggurat_retry<Symmetric>(z, words[k], engine);
+            }
+            out[first + k] = static_cast<T>(values[k] * scale + shift);
+        }
+    }
+}
+} // namespace detail::distribution
+
+/**
+ * @brief fill_random - fill with uniform random floating point values
+ *
+ *  - out[i] = a uniform random value in [min, max), drawn from context.
+ *    float takes two values from each 64 bit draw.
+ *
+ * @param[out] out The values to fill
+ * @param[in] min min random value
+ * @param[in] max max random value, not included
+ * @param[in,out] context The context to draw from, i.e. a ztd::random_context
+ */
+template<typename T, typename Context>
+inline void
+fill_random(const std::span<T> out, const T min, const T max, Context& context) noexcept
+    requires(std::is_floating_point_v<T> && detail::prng::is_engine64<Context>)
+{
+    ztd::panic_if(min > max);
+
+    using namespace detail::distribution;
+
+    const T scale = max - min;
+    std::array<std::uint64_t, block_size> words;
+    if constexpr (std::same_as<T, float>)
+    {
+        for (std::size_t first = 0; first < out.size(); first += 2 * block_size)
+        {
+            const auto count = std::min(2 * block_size, out.size() - first);
+            const auto draws = (count + 1) / 2;
+            draw_block(std::span(words).first(draws), context);
+
+            const auto whole = count / 2;
+            for (std::size_t k = 0; k < whole; ++k)
+            {
+                out[first + 2 * k] = min + scale * unit_float(std::uint32_t(words[k]));
+                out[first + 2 * k + 1] = min + scale * unit_float(std::uint32_t(words[k] >> 32));
+            }
+            if (count % 2 != 0)
+            {
+                out[first + count - 1] = min + scale * unit_float(std::uint32_t(words[whole]));
+            }
+        }
+    }
+    else
+    {
+        for (std::size_t first = 0; first < out.size(); first += block_size)
+        {
+            const auto count = std::min(block_size, out.size() - first);
+            draw_block(std::span(words).first(count), context);
+
+            for (std::size_t k = 0; k < count; ++k)
+            {
+                out[first + k] = min + scale * static_cast<T>(unit(words[k]));
+            }
+        }
+    }
+}
+
+/**
+ * @brief fill_random - fill with uniform random floating point values
+ *
+ *  - out[i] = a uniform random value in [min, max)
+ *
+ * @param[out] out The values to fill
+ * @param[in] min min random value
+ * @param[in] max max random value, not included
+ */
+template<typename T>
+inline void
+fill_random(const std::span<T> out, const T min = T(0), const T max = T(1)) noexcept
+    requires(std::is_floating_point_v<T>)
+{
+    fill_random(out, min, max, detail::rng());
+}
+
+/**
+ * @brief fill_normal - fill with normally distributed values
+ *
+ *  - out[i] = a value from N(mean, stddev^2), drawn from context with a
+ *    ziggurat.
+ *
+ * @param[out] out The values to fill
+ * @param[in] mean The mean of the distribution
+ * @param[in] stddev The standard deviation of the distribution
+ * @param[in,out] context The context to draw from, i.e. a ztd::random_context
+ */
+template<typename T, typename Context>
+inline void
+fill_normal(const std::span<T> out, const T mean, const T stddev, Context& context) noexcept
+    requires(std::is_floating_point_v<T> && detail::prng::is_engine64<Context>)
+{
+    ztd::panic_if(!(stddev >= T(0)));
+
+    detail::distribution::fill_ziggurat<true>(out,
+                                              detail::distribution::normal_ziggurat(),
+                                              double(stddev),
+                                              double(mean),
+                                              context);
+}
+
+/**
+ * @brief fill_normal - fill with normally distributed values
+ *
+ *  - out[i] = a value from N(mean, stddev^2)
+ *
+ * @param[out] out The values to fill
+ * @param[in] mean The mean of the distribution
+ * @param[in] stddev The standard deviation of the distribution
+ */
+template<typename T>
+inline void
+fill_normal(const std::span<T> out, const T mean = T(0), const T stddev = T(1)) noexcept
+    requires(std::is_floating_point_v<T>)
+{
+    fill_normal(out, mean, stddev, detail::rng());
+}
+
+/**
+ * @brief fill_exponential - fill with exponentially distributed values
+ *
+ *  - out[i] = a value from Exp(lambda), i.e. the time between events that
+ *    happen lambda times per unit of time on average. Drawn from context
+ *    with a ziggurat.
+ *
+ * @param[out] out The values to fill
+ * @param[in] lambda The rate of the distribution, must be positive
+ * @param[in,out] context The context to draw from, i.e. a ztd::random_context
+ */
+template<typename T, typename Context>
+inline void
+fill_exponential(const std::span<T> out, const T lambda, Context& context) noexcept
+    requires(std::is_floating_point_v<T> && detail::prng::is_engine64<Context>)
+{
+    ztd::panic_if(!(lambda > T(0)));
+
+    detail::distribution::fill_ziggurat<false>(out,
+                                               detail::distribution::exponential_ziggurat(),
+                                               1.0 / double(lambda),
+                                               0.0,
+                                               context);
+}
+
+/**
+ * @brief fill_exponential - fill with exponentially distributed values
+ *
+ *  - out[i] = a value from Exp(lambda)
+ *
+ * @param[out] out The values to fill
+ * @param[in] lambda The rate of the distribution, must be positive
+ */
+template<typename T>
+inline void
+fill_exponential(const std::span<T> out, const T lambda = T(1)) noexcept
+    requires(std::is_floating_point_v<T>)
+{
+    fill_exponential(out, lambda, detail::rng());
+}
+
+/**
+ * @brief fill_random - fill with random bools
+ *
+ *  - one bit per bool, so each 64 bit draw gives 64 bools
+ *
+ * @param[out] out The values to fill
+ * @param[in,out] context The context to draw from, i.e. a ztd::random_context
+ */
+template<typename Context>
+inline void
+fill_random(const std::span<bool> out, Context& context) noexcept
+    requires(detail::prng::is_engine64<Context>)
+{
+    for (std::size_t first = 0; first < out.size(); first += 64)
+    {
+        const auto count = std::min(std::size_t(64), out.size() - first);
+        const std::uint64_t word = context();
+        for (std::size_t k = 0; k < count; ++k)
+        {
+            out[first + k] = ((word >> k) & 1) != 0;
+        }
+    }
+}
+
+/**
+ * @brief fill_random - fill with random bools
+ *
+ *  - one bit per bool, so each 64 bit draw gives 64 bools
+ *
+ * @param[out] out The values to fill
+ */
+inline void
+fill_random(const std::span<bool> out) noexcept
+{
+    fill_random(out, detail::rng());
+}
+} // namespace ztd
@@ -0,0 +1,353 @@
+/**
+ * Copyright (C) 2025 Brandon Zorn <brandonzorn@cock.li>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+
+// Small, fast, non-cryptographic engines. All of them model
+// std::uniform_random_bit_generator with a full 64 bit result, so they can be
+// used with both the <random> distributions and the ztd::random functions.
+//
+// Every engine is seeded from a single 64 bit value that is expanded with
+// splitmix64, so that similar seeds still give unrelated streams.
+
+namespace ztd
+{
+namespace detail::prng
+{
+__extension__ using uint128 = unsigned __int128;
+
+[[nodiscard]] constexpr std::uint64_t
+splitmix64(std::uint64_t& state) noexcept
+{
+    std::uint64_t z = (state += 0x9e3779b97f4a7c15);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+    return z ^ (z >> 31);
+}
+
+// an engine that returns every bit pattern of a std::uint64_t
+template<typename Engine>
+concept is_engine64 = std::uniform_random_bit_generator<Engine> &&
+                      std::same_as<typename Engine::result_type, std::uint64_t> &&
+                      Engine::min() == 0 &&
+                      Engine::max() == std::numeric_limits<std::uint64_t>::max();
+
+/**
+ * @brief bounded - Lemire's nearly divisionless method
+ *
+ *  - a uniform value in [0, bound), bound != 0. The multiply maps a draw onto
+ *    the range, and the division to find the biased draws is only done when
+ *    the low half lands inside the (small) rejection zone.
+ */
+template<typename Engine>
+[[nodiscard]] inline std::uint64_t
+bounded(Engine& engine, const std::uint64_t bound) noexcept
+    requires(is_engine64<Engine>)
+{
+    uint128 m = uint128(engine()) * bound;
+    auto low = std::uint64_t(m);
+    if (low < bound)
+    {
+        const std::uint64_t threshold = -bound % bound;
+        while (low < threshold)
+        {
+            m = uint128(engine()) * bound;
+            low = std::uint64_t(m);
+        }
+    }
+    return std::uint64_t(m >> 64);
+}
+} // namespace detail::prng
+
+/**
+ * @brief xoshiro256pp
+ *
+ *  - xoshiro256++ by Blackman and Vigna, 256 bits of state and a period of
+ *    2^256 - 1. The default engine for ztd::random.
+ */
+class xoshiro256pp final
+{
+  public:
+    using result_type = std::uint64_t;
+
+    static constexpr std::uint64_t default_seed = 0;
+
+    constexpr xoshiro256pp() noexcept { this->seed(default_seed); }
+
+    constexpr explicit xoshiro256pp(const std::uint64_t seed) noexcept { this->seed(seed); }
+
+    constexpr void
+    seed(std::uint64_t seed) noexcept
+    {
+        for (auto& s : this->state_)
+        {
+            s = detail::prng::splitmix64(seed);
+        }
+    }
+
+    [[nodiscard]] static constexpr result_type
+    min() noexcept
+    {
+        return std::numeric_limits<result_type>::min();
+    }
+
+    [[nodiscard]] static constexpr result_type
+    max() noexcept
+    {
+        return std::numeric_limits<result_type>::max();
+    }
+
+    constexpr result_type
+    operator()() noexcept
+    {
+        auto& s = this->state_;
+        const auto result = std::rotl(s[0] + s[3], 23) + s[0];
+        const auto t = s[1] << 17;
+
+        s[2] ^= s[0];
+        s[3] ^= s[1];
+        s[1] ^= s[2];
+        s[0] ^= s[3];
+        s[2] ^= t;
+        s[3] = std::rotl(s[3], 45);
+
+        return result;
+    }
+
+    constexpr void
+    discard(unsigned long long z) noexcept
+    {
+        for (; z != 0; --z)
+        {
+            (void)(*this)();
+        }
+    }
+
+    /**
+     * @brief jump - advance by 2^128 draws
+     *
+     *  - gives 2^128 non-overlapping sequences of 2^128 draws each, i.e. one
+     *    per thread.
+     */
+    constexpr void
+    jump() noexcept
+    {
+        this->jump(
+            {0x180ec6d33cfd0aba, 0xd5a61266f0c9392c, 0xa9582618e03fc9aa, 0x39abdc4529b1661c});
+    }
+
+    /**
+     * @brief long_jump - advance by 2^192 draws
+     *
+     *  - gives 2^64 starting points, each of which can be split again with
+     *    jump(), i.e. one per machine.
+     */
+    constexpr void
+    long_jump() noexcept
+    {
+        this->jump(
+            {0x76e15d3efefdcbbf, 0xc5004e441c522fb3, 0x77710069854ee241, 0x39109bb02acbe635});
+    }
+
+    [[nodiscard]] constexpr bool operator==(const xoshiro256pp&) const noexcept = default;
+
+  private:
+    constexpr void
+    jump(const std::array<std::uint64_t, 4>& polynomial) noexcept
+    {
+        std::array<std::uint64_t, 4> state{};
+        for (const auto word : polynomial)
+        {
+            for (std::size_t bit = 0; bit < 64; ++bit)
+            {
+                if ((word & (std::uint64_t(1) << bit)) != 0)
+                {
+                    for (std::size_t i = 0; i < state.size(); ++i)
+                    {
+                        state[i] ^= this->state_[i];
+                    }
+                }
+                (void)(*this)();
+            }
+        }
+        this->state_ = state;
+    }
+
+    std::array<std::uint64_t, 4> state_{};
+};
+
+/**
+ * @brief wyrand
+ *
+ *  - wyrand by Wang Yi, 64 bits of state and a period of 2^64. The fastest of
+ *    the engines, for when the period and the state size do not matter.
+ */
+class wyrand final
+{
+  public:
+    using result_type = std::uint64_t;
+
+    static constexpr std::uint64_t default_seed = 0;
+
+    constexpr wyrand() noexcept { this->seed(default_seed); }
+
+    constexpr explicit wyrand(const std::uint64_t seed) noexcept { this->seed(seed); }
+
+    constexpr void
+    seed(std::uint64_t seed) noexcept
+    {
+        this->state_ = detail::prng::splitmix64(seed);
+    }
+
+    [[nodiscard]] static constexpr result_type
+    min() noexcept
+    {
+        return std::numeric_limits<result_type>::min();
+    }
+
+    [[nodiscard]] static constexpr result_type
+    max() noexcept
+    {
+        return std::numeric_limits<result_type>::max();
+    }
+
+    constexpr result_type
+    operator()() noexcept
+    {
+        this->state_ += 0xa0761d6478bd642f;
+        const auto m =
+            detail::prng::uint128(this->state_) * (this->state_ ^ 0xe7037ed1a0b428db);
+        return std::uint64_t(m >> 64) ^ std::uint64_t(m);
+    }
+
+    constexpr void
+    discard(const unsigned long long z) noexcept
+    {
+        this->state_ += 0xa0761d6478bd642f * z;
+    }
+
+    [[nodiscard]] constexpr bool operator==(const wyrand&) const noexcept = default;
+
+  private:
+    std::uint64_t state_{};
+};
+
+/**
+ * @brief pcg64
+ *
+ *  - PCG64 (XSL RR 128/64) by O'Neill, a 128 bit LCG with a permuted output
+ *    and a period of 2^128. The stream selects one of 2^127 distinct sequences
+ *    for the same seed.
+ */
+class pcg64 final
+{
+  public:
+    using result_type = std::uint64_t;
+
+    static constexpr std::uint64_t default_seed = 0;
+    static constexpr std::uint64_t default_stream = 0;
+
+    constexpr pcg64() noexcept { this->seed(default_seed); }
+
+    constexpr explicit pcg64(const std::uint64_t seed,
+                             const std::uint64_t stream = default_stream) noexcept
+    {
+        this->seed(seed, stream);
+    }
+
+    constexpr void
+    seed(std::uint64_t seed, std::uint64_t stream = default_stream) noexcept
+    {
+        const auto state = (detail::prng::uint128(detail::prng::splitmix64(seed)) << 64) |
+                           detail::prng::splitmix64(seed);
+        const auto sequence = (detail::prng::uint128(detail::prng::splitmix64(stream)) << 64) |
+                              detail::prng::splitmix64(stream);
+
+        // the same initialization as the reference pcg_setseq_128_srandom_r
+        this->increment_ = (sequence << 1) | 1;
+        this->state_ = 0;
+        this->step();
+        this->state_ += state;
+        this->step();
+    }
+
+    [[nodiscard]] static constexpr result_type
+    min() noexcept
+    {
+        return std::numeric_limits<result_type>::min();
+    }
+
+    [[nodiscard]] static constexpr result_type
+    max() noexcept
+    {
+        return std::numeric_limits<result_type>::max();
+    }
+
+    constexpr result_type
+    operator()() noexcept
+    {
+        this->step();
+        const auto rotate = int(this->state_ >> 122);
+        return std::rotr(std::uint64_t(this->state_ >> 64) ^ std::uint64_t(this->state_), rotate);
+    }
+
+    constexpr void
+    discard(unsigned long long z) noexcept
+    {
+        // jump ahead in O(log z), Brown's "Random Number Generation with
+        // Arbitrary Strides"
+        auto multiplier = multiplier_;
+        auto increment = this->increment_;
+        detail::prng::uint128 acc_multiplier = 1;
+        detail::prng::uint128 acc_increment = 0;
+        for (; z != 0; z >>= 1)
+        {
+            if ((z & 1) != 0)
+            {
+                acc_multiplier *= multiplier;
+                acc_increment = acc_increment * multiplier + increment;
+            }
+            increment = (multiplier + 1) * increment;
+            multiplier *= multiplier;
+        }
+        this->state_ = acc_multiplier * this->state_ + acc_increment;
+    }
+
+    [[nodiscard]] constexpr bool operator==(const pcg64&) const noexcept = default;
+
+  private:
+    static constexpr detail::prng::uint128 multiplier_ =
+        (detail::prng::uint128(0x2360ed051fc65da4) << 64) | 0x4385df649fccf645;
+
+    constexpr void
+    step() noexcept
+    {
+        this->state_ = this->state_ * multiplier_ + this->increment_;
+    }
+
+    detail::prng::uint128 state_{};
+    detail::prng::uint128 increment_{};
+};
+} // namespace ztd
@@ -0,0 +1,250 @@
+/**
+ * Copyright (C) 2025 Brandon Zorn <brandonzorn@cock.li>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <span>
+#include <string>
+#include <system_error>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+
+#include <pthread.h>
+#include <string.h>
+#include <sys/random.h>
+
+#include "string_random.hxx"
+#include "types.hxx"
+
+// Random bytes from the kernel CSPRNG, for session tokens and keys.
+//
+// Small requests are served from a per-thread buffer that is refilled with
+// one getrandom(2) call, so that the syscall is amortized over many tokens.
+// Bytes are wiped from the buffer as they are handed out, and the buffer is
+// discarded in the child after a fork, so that two processes never hand out
+// the same bytes.
+
+namespace ztd
+{
+namespace detail::secure_random
+{
+inline constexpr std::size_t buffer_size = 4096;
+
+// fill out directly from the kernel
+inline void
+getrandom(std::span<std::byte> out)
+{
+    while (!out.empty())
+    {
+        const auto n = ::getrandom(out.data(), out.size(), 0);
+        if (n < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            throw std::system_error(errno, std::generic_category(), "getrandom failed");
+        }
+        out = out.subspan(std::size_t(n));
+    }
+}
+
+// bumped in the child after every fork
+inline std::atomic<std::uint64_t> fork_generation = 0;
+
+inline void
+register_fork_handler() noexcept
+{
+    static const bool registered = []
+    {
+        ::pthread_atfork(nullptr,
+                         nullptr,
+                         [] { fork_generation.fetch_add(1, std::memory_order_relaxed); });
+        return true;
+    }();
+    (void)registered;
+}
+
+struct buffer
+{
+    std::array<std::byte, buffer_size> bytes;
+    std::size_t used = buffer_size;
+    std::uint64_t generation = 0;
+
+    void
+    take(std::span<std::byte> out)
+    {
+        const auto current = fork_generation.load(std::memory_order_relaxed);
+        if (current != this->generation)
+        {
+            this->used = buffer_size;
+            this->generation = current;
+        }
+
+        while (!out.empty())
+        {
+            if (this->used == buffer_size)
+            {
+                secure_random::getrandom(this->bytes);
+                this->used = 0;
+            }
+
+            const auto n = std::min(out.size(), buffer_size - this->used);
+            const auto available = std::span(this->bytes).subspan(this->used, n);
+            std::ranges::copy(available, out.begin());
+            std::ranges::fill(available, std::byte(0));
+
+            this->used += n;
+            out = out.subspan(n);
+        }
+    }
+};
+
+inline buffer&
+thread_buffer() noexcept
+{
+    register_fork_handler();
+    static thread_local buffer b;
+    return b;
+}
+} // namespace detail::secure_random
+
+/**
+ * @brief secure_random_bytes
+ *
+ *  - fill out with bytes from the kernel CSPRNG. Requests smaller than the
+ *    per-thread buffer do not make a syscall each.
+ *
+ * @param[out] out The buffer to fill
+ *
+ * @throws std::system_error if getrandom(2) fails
+ */
+inline void
+secure_random_bytes(const std::span<std::byte> out)
+{
+    if (out.size() >= detail::secure_random::buffer_size)
+    {
+        detail::secure_random::getrandom(out);
+        return;
+    }
+    detail::secure_random::thread_buffer().take(out);
+}
+
+/**
+ * @brief secure_random_hex
+ *
+ *  - fill a caller buffer with hex characters from the kernel CSPRNG, two
+ *    characters per byte.
+ *
+ * @param[out] out The buffer to fill
+ *
+ * @throws std::system_error if getrandom(2) fails
+ */
+inline void
+secure_random_hex(const std::span<char> out)
+{
+    std::array<std::byte, 256> bytes;
+    for (std::size_t first = 0; first < out.size(); first += 2 * bytes.size())
+    {
+        const auto count = std::min(2 * bytes.size(), out.size() - first);
+        const auto random = std::span(bytes).first((count + 1) / 2);
+        secure_random_bytes(random);
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const auto byte = std::to_integer<std::size_t>(random[i / 2]);
+            const auto nibble = (i % 2 == 0) ? (byte >> 4) : (byte & 0xf);
+            out[first + i] = detail::string_random::hex_table[nibble];
+        }
+        ::explicit_bzero(random.data(), random.size());
+    }
+}
+
+/**
+ * @brief secure_random_hex
+ * @param[in] len Length of the random string to return
+ * @return a hex string from the kernel CSPRNG, i.e. a session token
+ *
+ * @throws std::system_error if getrandom(2) fails
+ */
+[[nodiscard]] inline std::string
+secure_random_hex(const ztd::usize len = 32_usize)
+{
+    std::string str(len.data(), '\0');
+    secure_random_hex(std::span(str));
+    return str;
+}
+
+/**
+ * @brief secure_random_string
+ *
+ *  - fill a caller buffer with [0-9A-Za-z] characters from the kernel CSPRNG.
+ *    The low 6 bits of each byte pick a character, and the 2 out of 64
+ *    values past the alphabet are skipped so that there is no bias.
+ *
+ * @param[out] out The buffer to fill
+ *
+ * @throws std::system_error if getrandom(2) fails
+ */
+inline void
+secure_random_string(const std::span<char> out)
+{
+    using detail::string_random::alnum_size;
+    using detail::string_random::alnum_table;
+
+    std::array<std::byte, 256> bytes;
+    std::size_t i = 0;
+    while (i < out.size())
+    {
+        // a few more than needed, to cover the skipped values
+        const auto wanted = out.size() - i;
+        const auto random =
+            std::span(bytes).first(std::min(bytes.size(), wanted + wanted / 16 + 1));
+        secure_random_bytes(random);
+
+        for (const auto byte : random)
+        {
+            const auto group = std::to_integer<std::size_t>(byte) & 0x3f;
+            if (group < alnum_size && i < out.size())
+            {
+                out[i++] = alnum_table[group];
+            }
+        }
+        ::explicit_bzero(random.data(), random.size());
+    }
+}
+
+/**
+ * @brief secure_random_string
+ * @param[in] len Length of the random string to return
+ * @return a [0-9A-Za-z] string from the kernel CSPRNG, i.e. a session token
+ *
+ * @throws std::system_error if getrandom(2) fails
+ */
+[[nodiscard]] inline std::string
+secure_random_string(const ztd::usize len = 32_usize)
+{
+    std::string str(len.data(), '\0');
+    secure_random_string(std::span(str));
+    return str;
+}
+} // namespace ztd
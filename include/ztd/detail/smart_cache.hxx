@@ -17,18 +17,38 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
 #include <functional>
+#include <future>
 #include <memory>
 #include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <thread>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
+#include "cache_eviction.hxx"
 #include "panic.hxx"
 
 // Based on <https://gist.github.com/reyoung/87f230ebc0dfc242ad90>
 
 namespace ztd
 {
+struct smart_cache_stats final
+{
+    std::uint64_t hits = 0;
+    std::uint64_t misses = 0;
+    std::uint64_t evictions = 0;
+};
+
 /**
  * Smart Pointer Key-Value Cache
  *
@@ -38,23 +58,119 @@ namespace ztd
  * If there is a instance stored in cache, then it will return a shared_ptr of it,
  * otherwise, it will return a nullptr;
  *
+ * All member functions are thread safe. The keys are split over a number of
+ * shards by hash, each with its own std::shared_mutex, so lookups only take a
+ * shared lock and writers only block the keys of one shard. The creator of
+ * create() runs without any lock held, concurrent calls for the same key wait
+ * for the first one instead of creating the value again. create_async()
+ * returns a future instead of waiting for the creator, which runs on a pool of
+ * at most std::thread::hardware_concurrency() threads owned by the cache.
+ *
+ * The entries of destroyed values are swept from a shard each time it doubles
+ * in size, so memory stays proportional to the live values. compact() sweeps
+ * right away.
+ *
+ * A bounded cache also keeps a strong reference to up to capacity values, so
+ * that the most valuable values survive while nobody holds them. Which values
+ * are kept is up to the cache_eviction policy. Values pinned with
+ * keep_internal_reference do not count towards the capacity.
+ *
+ * With a transparent Hash and KeyEqual, i.e. ztd::string_hash and
+ * ztd::string_equal, the lookups take any key type that they accept, so that
+ * a std::string_view finds a std::string key without building one.
+ *
  * The KType is the key type.
  * The VType is the value type.
+ * The Hash and KeyEqual are the hash and equality of the keys.
  */
-template<typename KType, typename VType> class smart_cache final
+template<typename KType, typename VType, typename Hash = std::hash<KType>,
+         typename KeyEqual = std::equal_to<KType>>
+class smart_cache final
 {
   public:
+    static constexpr std::size_t default_shards = 16;
+
+    smart_cache() noexcept : smart_cache(default_shards) {}
+
+    /**
+     * @param[in] shards The number of independently locked shards, i.e. about
+     * the number of threads that use the cache at the same time
+     */
+    explicit smart_cache(const std::size_t shards) noexcept
+        : shards_(std::max(shards, std::size_t(1)))
+    {
+    }
+
+    /**
+     * @param[in] capacity The number of values that are kept alive by the
+     * cache, split over the shards. 0 keeps none, as smart_cache(shards)
+     * @param[in] eviction Which values to keep once there are more
+     * @param[in] shards The number of independently locked shards, at most
+     * capacity
+     */
+    smart_cache(const std::size_t capacity, const cache_eviction eviction,
+                const std::size_t shards = default_shards) noexcept
+        : shards_(capacity == 0 ? std::max(shards, std::size_t(1))
+                                : std::clamp(shards, std::size_t(1), capacity)),
+          capacity_(capacity)
+    {
+        if (capacity == 0)
+        {
+            return;
+        }
+
+        const auto n = this->shards_.size();
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            this->shards_[i].resident.emplace((capacity / n) + (i < capacity % n ? 1 : 0),
+                                              eviction);
+        }
+    }
+
+    ~smart_cache() noexcept
+    {
+        // the creators of create_async() still use the cache, the workers
+        // run the queued ones before they stop
+        {
+            std::scoped_lock lock(this->work_lock_);
+            this->stopping_ = true;
+        }
+        this->work_ready_.notify_all();
+        this->workers_.clear();
+    }
+
+    smart_cache(const smart_cache&) = delete;
+    smart_cache& operator=(const smart_cache&) = delete;
+    smart_cache(smart_cache&&) = delete;
+    smart_cache& operator=(smart_cache&&) = delete;
+
     // Element access
 
     [[nodiscard]] std::shared_ptr<VType>
     at(const KType& key) const noexcept
     {
-        if (this->storage_.contains(key))
+        return this->at<KType>(key);
+    }
+
+    template<typename K>
+    [[nodiscard]] std::shared_ptr<VType>
+    at(const K& key) const noexcept
+        requires(detail::cache::is_lookup_key<K, KType, Hash, KeyEqual>)
+    {
+        const auto& shard = this->shard(key);
+        std::shared_lock lock(shard.lock);
+
+        const auto it = shard.storage.find(key);
+        if (it != shard.storage.end())
         {
-            auto& val = this->storage_.at(key);
-            auto ret_val = val.lock();
-            return ret_val;
+            auto ret_val = it->second.lock();
+            if (ret_val != nullptr)
+            {
+                shard.hit(key);
+                return ret_val;
+            }
         }
+        shard.misses.fetch_add(1, std::memory_order_relaxed);
         // throw std::out_of_range("");
         return nullptr;
     }
@@ -64,31 +180,51 @@ template<typename KType, typename VType> class smart_cache final
     [[nodiscard]] auto
     count(const KType& key) const noexcept
     {
-        return this->storage_.count(key);
+        return this->count<KType>(key);
+    }
+
+    template<typename K>
+    [[nodiscard]] auto
+    count(const K& key) const noexcept
+        requires(detail::cache::is_lookup_key<K, KType, Hash, KeyEqual>)
+    {
+        const auto& shard = this->shard(key);
+        std::shared_lock lock(shard.lock);
+
+        return shard.storage.count(key);
     }
 
     [[nodiscard]] bool
     contains(const KType& key) const noexcept
     {
-        if (this->storage_.contains(key))
-        {
-            auto& val = this->storage_.at(key);
-            auto ret_val = val.lock();
-            return (ret_val != nullptr);
-        }
-        return false;
+        return this->contains<KType>(key);
+    }
+
+    template<typename K>
+    [[nodiscard]] bool
+    contains(const K& key) const noexcept
+        requires(detail::cache::is_lookup_key<K, KType, Hash, KeyEqual>)
+    {
+        const auto& shard = this->shard(key);
+        std::shared_lock lock(shard.lock);
+
+        const auto it = shard.storage.find(key);
+        return it != shard.storage.end() && !it->second.expired();
     }
 
     [[nodiscard]] std::vector<KType>
     keys() const noexcept
     {
         std::vector<KType> keys;
-        for (const auto& pair : this->storage_)
+        for (const auto& shard : this->shards_)
         {
-            const auto& key = pair.first;
-            if (this->contains(key))
-            { // only add valid keys
-                keys.emplace_back(key);
+            std::shared_lock lock(shard.lock);
+            for (const auto& [key, value] : shard.storage)
+            {
+                if (!value.expired())
+                { // only add valid keys
+                    keys.emplace_back(key);
+                }
             }
         }
         return keys;
@@ -98,12 +234,16 @@ template<typename KType, typename VType> class smart_cache final
     items() const noexcept
     {
         std::vector<std::shared_ptr<VType>> items;
-        for (const auto& pair : this->storage_)
+        for (const auto& shard : this->shards_)
         {
-            const auto& key = pair.first;
-            if (this->contains(key))
-            { // only add valid items
-                items.emplace_back(this->storage_.at(key));
+            std::shared_lock lock(shard.lock);
+            for (const auto& [key, value] : shard.storage)
+            {
+                auto item = value.lock();
+                if (item != nullptr)
+                { // only add valid items
+                    items.emplace_back(std::move(item));
+                }
             }
         }
         return items;
@@ -111,78 +251,580 @@ template<typename KType, typename VType> class smart_cache final
 
     // Modifiers
 
+    template<typename Creator>
+    [[nodiscard]] std::shared_ptr<VType>
+    create(const KType& key, Creator&& creator, const bool keep_internal_reference = false) noexcept
+        requires(detail::cache::is_creator<Creator, VType>)
+    {
+        return this->create_impl(key, std::forward<Creator>(creator), keep_internal_reference);
+    }
+
+    /**
+     * @brief create
+     *
+     *  - the key is only converted to a KType if the value is not cached
+     */
+    template<typename K, typename Creator>
     [[nodiscard]] std::shared_ptr<VType>
-    create(const KType& key, const std::function<std::shared_ptr<VType>()>& creator,
-           const bool keep_internal_reference = false) noexcept
+    create(const K& key, Creator&& creator, const bool keep_internal_reference = false) noexcept
+        requires(detail::cache::is_lookup_key<K, KType, Hash, KeyEqual> &&
+                 detail::cache::is_creator<Creator, VType>)
+    {
+        return this->create_impl(key, std::forward<Creator>(creator), keep_internal_reference);
+    }
+
+    template<typename Creator>
+    [[nodiscard]] std::shared_future<std::shared_ptr<VType>>
+    create_async(const KType& key, Creator&& creator, const bool keep_internal_reference = false)
+        requires(detail::cache::is_creator<Creator, VType>)
+    {
+        return this->create_async_impl(key,
+                                       std::forward<Creator>(creator),
+                                       keep_internal_reference);
+    }
+
+    /**
+     * @brief create_async
+     *
+     *  - create() without waiting for the creator. The creators are queued
+     *    and run on the worker threads of the cache, which are started on
+     *    demand up to std::thread::hardware_concurrency(). A cached value
+     *    gives a future that is already ready, and a value that is already
+     *    being created gives the future of that creation. The cache runs the
+     *    queued creators when it is destroyed.
+     *
+     *  - the creator must not wait for another create_async() of the same
+     *    cache, all the workers could be waiting for creators that are still
+     *    queued.
+     *
+     * @return the value, or the exception thrown by the creator. A create()
+     * that waited for that creator runs its own creator instead.
+     *
+     * @throws std::system_error if the cache has no worker thread and can not
+     * start one
+     */
+    template<typename K, typename Creator>
+    [[nodiscard]] std::shared_future<std::shared_ptr<VType>>
+    create_async(const K& key, Creator&& creator, const bool keep_internal_reference = false)
+        requires(detail::cache::is_lookup_key<K, KType, Hash, KeyEqual> &&
+                 detail::cache::is_creator<Creator, VType>)
+    {
+        return this->create_async_impl(key,
+                                       std::forward<Creator>(creator),
+                                       keep_internal_reference);
+    }
+
+    void
+    clear() noexcept
+    {
+        for (auto& shard : this->shards_)
+        {
+            // the values are destroyed after the lock is released, in case
+            // their destructor uses the cache
+            decltype(shard.storage_permanent) permanent;
+            std::vector<std::shared_ptr<VType>> resident;
+            {
+                std::unique_lock lock(shard.lock);
+                permanent.swap(shard.storage_permanent);
+                if (shard.resident)
+                {
+                    resident = shard.resident->clear();
+                }
+                shard.storage.clear();
+                shard.sweep_at = min_sweep;
+            }
+        }
+    }
+
+    void
+    erase(const KType& key) noexcept
     {
-        std::scoped_lock<std::mutex> lock(this->lock_);
+        this->erase<KType>(key);
+    }
 
-        if (this->storage_.contains(key))
+    template<typename K>
+    void
+    erase(const K& key) noexcept
+        requires(detail::cache::is_lookup_key<K, KType, Hash, KeyEqual>)
+    {
+        auto& shard = this->shard(key);
+
+        std::shared_ptr<VType> permanent;
+        std::shared_ptr<VType> resident;
         {
-            auto& val = this->storage_.at(key);
-            auto ret_val = val.lock();
+            std::unique_lock lock(shard.lock);
+
+            if (shard.resident)
+            {
+                resident = shard.resident->erase(key);
+            }
+
+            const auto it = shard.storage_permanent.find(key);
+            if (it != shard.storage_permanent.end())
+            {
+                permanent = std::move(it->second);
+                shard.storage_permanent.erase(it);
+            }
+
+            const auto entry = shard.storage.find(key);
+            if (entry != shard.storage.end())
+            {
+                shard.storage.erase(entry);
+            }
+        }
+    }
+
+    // Capacity
+
+    [[nodiscard]] bool
+    empty() const noexcept
+    {
+        for (const auto& shard : this->shards_)
+        {
+            std::shared_lock lock(shard.lock);
+            for (const auto& [key, value] : shard.storage)
+            {
+                if (!value.expired())
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    [[nodiscard]] auto
+    size() const noexcept
+    {
+        std::size_t size = 0;
+        for (const auto& shard : this->shards_)
+        {
+            std::shared_lock lock(shard.lock);
+            for (const auto& [key, value] : shard.storage)
+            {
+                if (!value.expired())
+                {
+                    ++size;
+                }
+            }
+        }
+        return size;
+    }
+
+    /**
+     * @brief compact
+     *
+     *  - remove the entries of every value that has been destroyed, and give
+     *    back the memory of their buckets. Expired entries are also removed
+     *    as the cache grows, this is for after a burst of short-lived values.
+     *
+     * @return the number of entries removed
+     */
+    std::size_t
+    compact() noexcept
+    {
+        std::size_t removed = 0;
+        for (auto& shard : this->shards_)
+        {
+            std::unique_lock lock(shard.lock);
+            removed += shard.sweep();
+            shard.storage.rehash(0);
+            shard.sweep_at = std::max(min_sweep, 2 * shard.storage.size());
+        }
+        return removed;
+    }
+
+    [[nodiscard]] std::size_t
+    shard_count() const noexcept
+    {
+        return this->shards_.size();
+    }
+
+    /**
+     * @return the number of values that are kept alive by the cache, 0 if the
+     * cache is not bounded
+     */
+    [[nodiscard]] std::size_t
+    capacity() const noexcept
+    {
+        return this->capacity_;
+    }
+
+    // Statistics
+
+    /**
+     * @return the lookups by at() and create() that found a live value, the
+     * ones that did not, and the values dropped by the eviction policy
+     */
+    [[nodiscard]] smart_cache_stats
+    stats() const noexcept
+    {
+        smart_cache_stats stats;
+        for (const auto& shard : this->shards_)
+        {
+            stats.hits += shard.hits.load(std::memory_order_relaxed);
+            stats.misses += shard.misses.load(std::memory_order_relaxed);
+            if (shard.resident)
+            {
+                std::shared_lock lock(shard.lock);
+                stats.evictions += shard.resident->evictions();
+            }
+        }
+        return stats;
+    }
+
+  private:
+    // a shard is not swept before it has this many entries
+    static constexpr std::size_t min_sweep = 64;
+
+    using future_type = std::shared_future<std::shared_ptr<VType>>;
+
+    // each shard on its own cache line, so that the locks of different
+    // shards do not false share
+    struct alignas(64) shard_type
+    {
+        mutable std::shared_mutex lock;
+        std::unordered_map<KType, std::weak_ptr<VType>, Hash, KeyEqual> storage;
+
+        // This is only used to hold a reference to prevent an object from being deleted
+        // when no one else holds a reference.
+        std::unordered_map<KType, std::shared_ptr<VType>, Hash, KeyEqual> storage_permanent;
+
+        // the values that are being created, the other callers of create()
+        // for the same key wait on these
+        std::unordered_map<KType, std::shared_future<std::shared_ptr<VType>>, Hash, KeyEqual>
+            in_flight;
+
+        // the values kept alive by a bounded cache. Lookups are const, but
+        // still reorder the eviction policy and count hits
+        mutable std::optional<detail::cache::resident<KType, VType, Hash, KeyEqual>> resident;
+
+        mutable std::atomic<std::uint64_t> hits = 0;
+        mutable std::atomic<std::uint64_t> misses = 0;
+
+        std::size_t sweep_at = min_sweep;
+
+        // a lookup found a live value, at least the shared lock has to be held
+        template<typename K>
+        void
+        hit(const K& key) const noexcept
+        {
+            this->hits.fetch_add(1, std::memory_order_relaxed);
+            if (this->resident)
+            {
+                this->resident->touch(key);
+            }
+        }
+
+        // remove the expired entries, the unique lock has to be held
+        std::size_t
+        sweep() noexcept
+        {
+            const auto expired = [](const auto& pair) { return pair.second.expired(); };
+            return std::size_t(std::erase_if(this->storage, expired));
+        }
+    };
+
+    template<typename K>
+    [[nodiscard]] std::size_t
+    shard_index(const K& key) const noexcept
+    {
+        if (this->shards_.size() == 1)
+        {
+            return 0;
+        }
+        // std::hash is the identity for integers, mix it so that sequential
+        // keys spread over the shards
+        const auto hash = std::uint64_t(Hash{}(key)) * 0x9e3779b97f4a7c15;
+        return std::size_t((hash >> 32) % this->shards_.size());
+    }
+
+    template<typename K>
+    [[nodiscard]] shard_type&
+    shard(const K& key) noexcept
+    {
+        return this->shards_[this->shard_index(key)];
+    }
+
+    template<typename K>
+    [[nodiscard]] const shard_type&
+    shard(const K& key) const noexcept
+    {
+        return this->shards_[this->shard_index(key)];
+    }
+
+    // the common case of create(), the value is already cached
+    template<typename K>
+    [[nodiscard]] std::shared_ptr<VType>
+    find(const shard_type& shard, const K& key) const noexcept
+    {
+        std::shared_lock lock(shard.lock);
+        const auto it = shard.storage.find(key);
+        if (it != shard.storage.end())
+        {
+            auto ret_val = it->second.lock();
             if (ret_val != nullptr)
             {
+                shard.hit(key);
                 return ret_val;
-            } // else fall trough. Because it is weak_ptr cache.
+            }
         }
+        return nullptr;
+    }
+
+    struct reserve_result
+    {
+        std::shared_ptr<VType> value;
+        future_type in_flight;
+    };
+
+    // the value of key, or the creation of it that another caller has in
+    // flight. If there is neither, key is registered as in flight with future
+    // and the caller has to create the value.
+    template<typename K>
+    [[nodiscard]] reserve_result
+    reserve(shard_type& shard, const K& key, const future_type& future) noexcept
+    {
+        std::unique_lock lock(shard.lock);
 
-        auto shared_ptr = creator();
-        ztd::panic_if(shared_ptr == nullptr);
-        std::shared_ptr<VType> ret_val(shared_ptr);
-        this->storage_.insert({key, ret_val});
+        // another thread may have created it while the lock was released
+        const auto it = shard.storage.find(key);
+        if (it != shard.storage.end())
+        {
+            auto ret_val = it->second.lock();
+            if (ret_val != nullptr)
+            {
+                shard.hit(key);
+                return {std::move(ret_val), {}};
+            } // else fall trough. Because it is weak_ptr cache.
+        }
 
-        if (keep_internal_reference)
+        // or is creating it right now
+        const auto flight = shard.in_flight.find(key);
+        if (flight != shard.in_flight.end())
         {
-            this->storage_permanent_.insert({key, ret_val});
+            shard.hits.fetch_add(1, std::memory_order_relaxed);
+            return {nullptr, flight->second};
         }
 
-        return ret_val;
+        shard.misses.fetch_add(1, std::memory_order_relaxed);
+        shard.in_flight.emplace(KType(key), future);
+        return {nullptr, {}};
     }
 
+    // store the created value of key, and wake the callers waiting for it
+    template<typename K>
     void
-    clear() noexcept
+    publish(shard_type& shard, const K& key, const std::shared_ptr<VType>& ret_val,
+            const bool keep_internal_reference,
+            std::promise<std::shared_ptr<VType>>& promise) noexcept
     {
-        this->storage_permanent_.clear();
-        this->storage_.clear();
+        // destroyed after the lock is released
+        std::shared_ptr<VType> evicted;
+        {
+            std::unique_lock lock(shard.lock);
+
+            // the only copies of the key, everything before was a lookup
+            const auto flight = shard.in_flight.find(key);
+            const KType owned = flight->first;
+            shard.in_flight.erase(flight);
+
+            shard.storage.insert_or_assign(owned, ret_val);
+            if (shard.storage.size() >= shard.sweep_at)
+            {
+                // amortized, the next sweep is only after the shard has doubled
+                shard.sweep();
+                shard.sweep_at = std::max(min_sweep, 2 * shard.storage.size());
+            }
+
+            if (keep_internal_reference)
+            {
+                shard.storage_permanent.insert_or_assign(owned, ret_val);
+            }
+            else if (shard.resident)
+            {
+                evicted = shard.resident->insert(owned, ret_val);
+            }
+        }
+        promise.set_value(ret_val);
     }
 
+    // the creation of key failed, the callers waiting for it get the
+    // exception from its promise
+    template<typename K>
     void
-    erase(const KType& key) noexcept
+    abandon(shard_type& shard, const K& key) noexcept
     {
-        std::scoped_lock<std::mutex> lock(this->lock_);
+        std::unique_lock lock(shard.lock);
+        const auto flight = shard.in_flight.find(key);
+        if (flight != shard.in_flight.end())
+        {
+            shard.in_flight.erase(flight);
+        }
+    }
 
-        if (this->storage_permanent_.contains(key))
+    template<typename K, typename Creator>
+    [[nodiscard]] std::shared_ptr<VType>
+    create_impl(const K& key, Creator&& creator, const bool keep_internal_reference) noexcept
+    {
+        auto& shard = this->shard(key);
+
+        auto ret_val = this->find(shard, key);
+        if (ret_val != nullptr)
         {
-            this->storage_permanent_.erase(key);
+            return ret_val;
         }
 
-        if (this->storage_.contains(key))
+        std::promise<std::shared_ptr<VType>> promise;
+        const auto future = promise.get_future().share();
+        while (true)
         {
-            this->storage_.erase(key);
+            const auto [value, in_flight] = this->reserve(shard, key, future);
+            if (value != nullptr)
+            {
+                return value;
+            }
+            if (!in_flight.valid())
+            {
+                break;
+            }
+
+            // wait for the other thread instead of creating the value twice
+            try
+            {
+                return in_flight.get();
+            }
+            catch (...)
+            { // the creator of create_async() failed and gave up the key, try
+              // again and create the value with this creator
+            }
         }
-    }
 
-    // Capacity
+        // no lock is held, so that the creator does not block the other keys
+        // of the shard, and can use the cache itself
+        ret_val = std::invoke(creator);
+        ztd::panic_if(ret_val == nullptr);
 
-    [[nodiscard]] bool
-    empty() const noexcept
+        this->publish(shard, key, ret_val, keep_internal_reference, promise);
+        return ret_val;
+    }
+
+    template<typename K, typename Creator>
+    [[nodiscard]] future_type
+    create_async_impl(const K& key, Creator&& creator, const bool keep_internal_reference)
     {
-        return this->keys().empty();
+        auto& shard = this->shard(key);
+
+        auto ret_val = this->find(shard, key);
+        if (ret_val != nullptr)
+        {
+            std::promise<std::shared_ptr<VType>> ready;
+            ready.set_value(std::move(ret_val));
+            return ready.get_future().share();
+        }
+
+        std::promise<std::shared_ptr<VType>> promise;
+        const auto future = promise.get_future().share();
+        const auto [value, in_flight] = this->reserve(shard, key, future);
+        if (value != nullptr)
+        {
+            std::promise<std::shared_ptr<VType>> ready;
+            ready.set_value(value);
+            return ready.get_future().share();
+        }
+        if (in_flight.valid())
+        {
+            return in_flight;
+        }
+
+        task_type task = [this,
+                          &shard,
+                          owned = KType(key),
+                          creator = std::forward<Creator>(creator),
+                          promise = std::move(promise),
+                          keep_internal_reference]() mutable noexcept
+        {
+            try
+            {
+                std::shared_ptr<VType> created = std::invoke(creator);
+                ztd::panic_if(created == nullptr);
+                this->publish(shard, owned, created, keep_internal_reference, promise);
+            }
+            catch (...)
+            {
+                this->abandon(shard, owned);
+                promise.set_exception(std::current_exception());
+            }
+        };
+
+        std::unique_lock lock(this->work_lock_);
+        this->work_.push_back(std::move(task));
+        if (this->idle_ < this->work_.size() && this->workers_.size() < this->max_workers_)
+        {
+            try
+            {
+                this->workers_.emplace_back([this] { this->work(); });
+            }
+            catch (...)
+            {
+                if (!this->workers_.empty())
+                { // the running workers get to it
+                    return future;
+                }
+
+                // nothing will run it, give up the key before the promise is
+                // destroyed with the task, so that the waiters can retry
+                task = std::move(this->work_.back());
+                this->work_.pop_back();
+                lock.unlock();
+                this->abandon(shard, key);
+                throw;
+            }
+        }
+        lock.unlock();
+        this->work_ready_.notify_one();
+        return future;
     }
 
-    [[nodiscard]] auto
-    size() const noexcept
+    // a worker thread, runs the creators of create_async() until the cache is
+    // destroyed and the queue is empty
+    void
+    work() noexcept
     {
-        return this->keys().size();
+        std::unique_lock lock(this->work_lock_);
+        while (true)
+        {
+            this->idle_ += 1;
+            this->work_ready_.wait(lock,
+                                   [this] { return this->stopping_ || !this->work_.empty(); });
+            this->idle_ -= 1;
+            if (this->work_.empty())
+            {
+                return;
+            }
+
+            auto task = std::move(this->work_.front());
+            this->work_.pop_front();
+            lock.unlock();
+            task();
+            lock.lock();
+        }
     }
 
-  private:
-    std::mutex lock_;
-    std::unordered_map<KType, std::weak_ptr<VType>, std::hash<KType>> storage_;
+    using task_type = std::move_only_function<void() noexcept>;
+
+    std::vector<shard_type> shards_;
+    std::size_t capacity_ = 0;
+
+    // the creators of create_async() that no worker has taken yet
+    std::mutex work_lock_;
+    std::condition_variable work_ready_;
+    std::deque<task_type> work_;
+    std::size_t idle_ = 0;
+    bool stopping_ = false;
+    const std::size_t max_workers_ = std::max(std::thread::hardware_concurrency(), 1u);
 
-    // This is only used to hold a reference to prevent an object from being deleted
-    // when no one else holds a reference.
-    std::unordered_map<KType, std::shared_ptr<VType>, std::hash<KType>> storage_permanent_;
+    // last, so that the workers are stopped before the rest is destroyed
+    std::vector<std::jthread> workers_;
 };
 } // namespace ztd
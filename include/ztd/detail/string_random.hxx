@@ -17,61 +17,255 @@
 
 #pragma once
 
-#include <ranges>
+#include <array>
+#include <cstdint>
+#include <span>
+#include <string>
 #include <string_view>
+#include <vector>
 
+#include "panic.hxx"
 #include "random.hxx"
 #include "types.hxx"
 
 namespace ztd
 {
+namespace detail::string_random
+{
+inline constexpr std::string_view hex_table = "0123456789ABCDEF";
+
+// 62 characters padded to 64, so that a 6 bit group maps to a character
+// with a 2 in 64 chance of being skipped instead of a division.
+inline constexpr std::string_view alnum_table = "0123456789"
+                                                "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+                                                "abcdefghijklmnopqrstuvwxyz"
+                                                "??";
+inline constexpr std::size_t alnum_size = 62;
+
+// 16 characters from every draw, 4 bits each
+template<typename Engine>
+inline void
+fill_hex(const std::span<char> out, Engine& engine) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 16 <= out.size(); i += 16)
+    {
+        const std::uint64_t draw = engine();
+        for (std::size_t j = 0; j < 16; ++j)
+        {
+            out[i + j] = hex_table[(draw >> (j * 4)) & 0xf];
+        }
+    }
+    if (i < out.size())
+    {
+        const std::uint64_t draw = engine();
+        for (std::size_t j = 0; i + j < out.size(); ++j)
+        {
+            out[i + j] = hex_table[(draw >> (j * 4)) & 0xf];
+        }
+    }
+}
+
+// up to 10 characters from every draw, 6 bits each
+template<typename Engine>
+inline void
+fill_alnum(const std::span<char> out, Engine& engine) noexcept
+{
+    std::size_t i = 0;
+    while (i < out.size())
+    {
+        std::uint64_t draw = engine();
+        for (std::size_t j = 0; j < 10 && i < out.size(); ++j)
+        {
+            const auto group = std::size_t(draw & 0x3f);
+            draw >>= 6;
+            if (group < alnum_size)
+            {
+                out[i++] = alnum_table[group];
+            }
+        }
+    }
+}
+
+template<typename Fill>
+[[nodiscard]] inline std::vector<std::string_view>
+fill_ids(const std::span<char> arena, const ztd::usize len, Fill&& fill) noexcept
+{
+    ztd::panic_if(len == 0_usize, "id length must not be zero");
+
+    const auto count = arena.size() / len.data();
+    const auto used = arena.first(count * len.data());
+    fill(used);
+
+    std::vector<std::string_view> ids;
+    ids.reserve(count);
+    for (std::size_t i = 0; i < used.size(); i += len.data())
+    {
+        ids.emplace_back(used.data() + i, len.data());
+    }
+    return ids;
+}
+} // namespace detail::string_random
+
 /**
  * @brief random_hex
+ *
+ *  - fill a caller buffer with random hex characters, 16 characters per
+ *    64 bit draw.
+ *
+ * @param[in,out] context The context to draw from, i.e. a ztd::random_context
+ * @param[out] out The buffer to fill
+ */
+template<typename Context>
+inline void
+random_hex(Context& context, const std::span<char> out) noexcept
+    requires(detail::prng::is_engine64<Context>)
+{
+    detail::string_random::fill_hex(out, context);
+}
+
+/**
+ * @brief random_hex
+ *
+ *  - fill a caller buffer with random hex characters, 16 characters per
+ *    64 bit draw.
+ *
+ * @param[out] out The buffer to fill
+ */
+inline void
+random_hex(const std::span<char> out) noexcept
+{
+    random_hex(detail::rng(), out);
+}
+
+/**
+ * @brief random_hex
+ * @param[in,out] context The context to draw from, i.e. a ztd::random_context
  * @param[in] len Length of the random string to return
  * @return Get a random hex string
  */
-[[nodiscard]] constexpr std::string
+template<typename Context>
+[[nodiscard]] inline std::string
+random_hex(Context& context, const ztd::usize len = 10_usize) noexcept
+    requires(detail::prng::is_engine64<Context>)
+{
+    std::string str(len.data(), '\0');
+    random_hex(context, std::span(str));
+    return str;
+}
+
+/**
+ * @brief random_hex
+ * @param[in] len Length of the random string to return
+ * @return Get a random hex string
+ */
+[[nodiscard]] inline std::string
 random_hex(const ztd::usize len = 10_usize) noexcept
 {
-    static constexpr std::string_view table = "0123456789ABCDEF";
+    return random_hex(detail::rng(), len);
+}
 
-    std::string str;
-    str.reserve(len.data());
-    for (const auto _ : std::views::iota(0ul, len.data()))
-    {
-        str += table.at(ztd::random<std::uint32_t>(0, table.size() - 1));
-    }
-    return str;
+/**
+ * @brief random_hex_ids
+ *
+ *  - fill an arena with as many random hex ids of length len as fit, i.e. to
+ *    mint a batch of request ids without an allocation per id.
+ *
+ * @param[out] arena The buffer the ids are written to, owned by the caller
+ * @param[in] len Length of each id, must not be zero
+ * @return views of the ids in arena
+ */
+[[nodiscard]] inline std::vector<std::string_view>
+random_hex_ids(const std::span<char> arena, const ztd::usize len) noexcept
+{
+    return detail::string_random::fill_ids(arena,
+                                           len,
+                                           [](const std::span<char> out) { random_hex(out); });
 }
 
-[[deprecated("replace with ztd::random_hex()")]] [[nodiscard]] constexpr std::string
+[[deprecated("replace with ztd::random_hex()")]] [[nodiscard]] inline std::string
 randhex(const ztd::usize len = 10_usize) noexcept
 {
     return random_hex(len);
 }
 
+/**
+ * @brief random_string
+ *
+ *  - fill a caller buffer with random [0-9A-Za-z] characters, up to 10
+ *    characters per 64 bit draw.
+ *
+ * @param[in,out] context The context to draw from, i.e. a ztd::random_context
+ * @param[out] out The buffer to fill
+ */
+template<typename Context>
+inline void
+random_string(Context& context, const std::span<char> out) noexcept
+    requires(detail::prng::is_engine64<Context>)
+{
+    detail::string_random::fill_alnum(out, context);
+}
+
+/**
+ * @brief random_string
+ *
+ *  - fill a caller buffer with random [0-9A-Za-z] characters, up to 10
+ *    characters per 64 bit draw.
+ *
+ * @param[out] out The buffer to fill
+ */
+inline void
+random_string(const std::span<char> out) noexcept
+{
+    random_string(detail::rng(), out);
+}
+
+/**
+ * @brief random_string
+ * @param[in,out] context The context to draw from, i.e. a ztd::random_context
+ * @param[in] len Length of the random string to return
+ * @return Get a random string
+ */
+template<typename Context>
+[[nodiscard]] inline std::string
+random_string(Context& context, const ztd::usize len = 10_usize) noexcept
+    requires(detail::prng::is_engine64<Context>)
+{
+    std::string str(len.data(), '\0');
+    random_string(context, std::span(str));
+    return str;
+}
+
 /**
  * @brief random_string
  * @param[in] len Length of the random string to return
  * @return Get a random hex string
  */
-[[nodiscard]] constexpr std::string
+[[nodiscard]] inline std::string
 random_string(const ztd::usize len = 10_usize) noexcept
 {
-    static constexpr std::string_view table = "0123456789"
-                                              "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
-                                              "abcdefghijklmnopqrstuvwxyz";
+    return random_string(detail::rng(), len);
+}
 
-    std::string str;
-    str.reserve(len.data());
-    for (const auto _ : std::views::iota(0ul, len.data()))
-    {
-        str += table.at(ztd::random<std::uint32_t>(0, table.size() - 1));
-    }
-    return str;
+/**
+ * @brief random_string_ids
+ *
+ *  - fill an arena with as many random [0-9A-Za-z] ids of length len as fit,
+ *    i.e. to mint a batch of temp file names without an allocation per id.
+ *
+ * @param[out] arena The buffer the ids are written to, owned by the caller
+ * @param[in] len Length of each id, must not be zero
+ * @return views of the ids in arena
+ */
+[[nodiscard]] inline std::vector<std::string_view>
+random_string_ids(const std::span<char> arena, const ztd::usize len) noexcept
+{
+    return detail::string_random::fill_ids(arena,
+                                           len,
+                                           [](const std::span<char> out) { random_string(out); });
 }
 
-[[deprecated("replace with ztd::random_string()")]] [[nodiscard]] constexpr std::string
+[[deprecated("replace with ztd::random_string()")]] [[nodiscard]] inline std::string
 randstr(const ztd::usize len = 10_usize) noexcept
 {
     return random_string(len);
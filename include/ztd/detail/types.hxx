@@ -17,13 +17,25 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <concepts>
 #include <format>
 #include <functional>
 
+#include "types/fixed.hxx"
 // #include "types/floating.hxx"
 #include "types/integer.hxx"
+#include "types/integer_charconv.hxx"
+#include "types/integer_divider.hxx"
+#include "types/integer_endian.hxx"
+#include "types/integer_numeric.hxx"
+#include "types/integer_packing.hxx"
+#include "types/integer_policy.hxx"
+#include "types/integer_range.hxx"
+#include "types/integer_span.hxx"
 #include "types/integer_type.hxx"
+#include "types/integer_varint.hxx"
 
 namespace ztd::v2::inline experimental
 {
@@ -216,16 +228,25 @@ template<typename T>
 struct std::formatter<T>
 {
     std::formatter<typename T::integer_type> inner_;
+    // an empty format spec, i.e. "{}", is plain base 10 and skips the inner formatter
+    bool plain_ = false;
 
     constexpr auto
     parse(std::format_parse_context& ctx)
     {
+        this->plain_ = ctx.begin() == ctx.end() || *ctx.begin() == '}';
         return inner_.parse(ctx);
     }
 
     auto
     format(const T& obj, std::format_context& ctx) const
     {
+        if (this->plain_)
+        {
+            std::array<char, 24> buffer;
+            const auto [ptr, ec] = ztd::to_chars(buffer.data(), buffer.data() + buffer.size(), obj);
+            return std::ranges::copy(buffer.data(), ptr, ctx.out()).out;
+        }
         return inner_.format(obj.data(), ctx);
     }
 };
@@ -262,6 +283,18 @@ using f32 = ztd::v2::f32;
 using f64 = ztd::v2::f64;
 } // namespace ztd
 
+// ztd::integer must be usable as a zero-copy view over raw integers, see ztd::as_integers()
+static_assert(ztd::detail::is_layout_compatible_integer<ztd::i8>);
+static_assert(ztd::detail::is_layout_compatible_integer<ztd::i16>);
+static_assert(ztd::detail::is_layout_compatible_integer<ztd::i32>);
+static_assert(ztd::detail::is_layout_compatible_integer<ztd::i64>);
+static_assert(ztd::detail::is_layout_compatible_integer<ztd::isize>);
+static_assert(ztd::detail::is_layout_compatible_integer<ztd::u8>);
+static_assert(ztd::detail::is_layout_compatible_integer<ztd::u16>);
+static_assert(ztd::detail::is_layout_compatible_integer<ztd::u32>);
+static_assert(ztd::detail::is_layout_compatible_integer<ztd::u64>);
+static_assert(ztd::detail::is_layout_compatible_integer<ztd::usize>);
+
 // clang-format on
 
 #if !defined(ZTD_DISABLE_GLOBAL_TYPES)
@@ -0,0 +1,922 @@
+/**
+ * Copyright (C) 2025 Brandon Zorn <brandonzorn@cock.li>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <compare>
+#include <concepts>
+#include <format>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <string_view>
+#include <system_error>
+#include <tuple>
+#include <type_traits>
+
+#include <cstdint>
+
+#if defined(ZTD_TEST_SUITE)
+#include <ostream>
+#endif
+
+#include "../charconv.hxx"
+#include "../concepts.hxx"
+#include "../panic.hxx"
+#include "integer.hxx"
+#include "integer_divider.hxx"
+#include "integer_type.hxx"
+
+// Fixed-point numbers stored as a ztd::integer scaled by a compile time factor.
+//
+//   ztd::fixed<ztd::i64, 16>  - value * 2^16, i.e. 16 fractional bits
+//   ztd::decimal<ztd::i64, 2> - value * 10^2, i.e. money in cents
+//
+// Addition and subtraction go straight to the integer. Multiplication and
+// division widen to twice the width, so the intermediate product can not
+// overflow, and round to nearest with ties to even.
+
+namespace ztd
+{
+namespace detail::fixed
+{
+using detail::divide::wide_t;
+
+/**
+ * @return Radix^Digits, or 0 if it does not fit in T
+ */
+template<typename T, int Radix, int Digits>
+[[nodiscard]] consteval T
+scale() noexcept
+{
+    T s = 1;
+    for (int i = 0; i < Digits; ++i)
+    {
+        if (__builtin_mul_overflow(s, T(Radix), &s))
+        {
+            return 0;
+        }
+    }
+    return s;
+}
+
+/**
+ * @return n / d rounded to nearest, ties to even. d must be positive.
+ */
+template<typename T>
+[[nodiscard]] constexpr T
+round_div(const T n, const T d) noexcept
+{
+    const T q = n / d;
+    const T r = n % d;
+
+    if constexpr (is_signed_integer<T> || std::same_as<T, divide::int128>)
+    {
+        const T abs_r = r < 0 ? T(-r) : r;
+        const T rest = T(d - abs_r);
+        const bool up = abs_r > rest || (abs_r == rest && (q & 1) != 0);
+        if (!up)
+        {
+            return q;
+        }
+        return n < 0 ? T(q - 1) : T(q + 1);
+    }
+    else
+    {
+        const T rest = T(d - r);
+        const bool up = r > rest || (r == rest && (q & 1) != 0);
+        return up ? T(q + 1) : q;
+    }
+}
+} // namespace detail::fixed
+
+template<typename Integer, int Radix, int Digits> class basic_fixed final
+{
+  public:
+    using value_type = Integer;
+    using integer_type = typename Integer::integer_type;
+
+    static constexpr int radix = Radix;
+    static constexpr int digits = Digits;
+
+    /**
+     * @brief scale - the raw value of 1, Radix^Digits
+     */
+    static constexpr integer_type scale = detail::fixed::scale<integer_type, Radix, Digits>();
+
+    static_assert(Radix == 2 || Radix == 10);
+    static_assert(Digits >= 0);
+    static_assert(scale != 0, "Radix^Digits does not fit in the integer type");
+
+    constexpr basic_fixed() noexcept = default;
+
+    /**
+     * @brief basic_fixed - a whole number
+     *
+     * @param[in] whole The integer part, side effects determined by default math mode.
+     */
+    constexpr explicit basic_fixed(const Integer whole) noexcept : value_(whole * Integer(scale))
+    {
+    }
+
+    /**
+     * @brief from_raw
+     * @return a fixed point number with the raw (already scaled) value raw
+     */
+    [[nodiscard]] static constexpr basic_fixed
+    from_raw(const Integer raw) noexcept
+    {
+        basic_fixed result;
+        result.value_ = raw;
+        return result;
+    }
+
+    /**
+     * @brief checked_create
+     * @return whole as a fixed point number, or std::nullopt if it does not fit.
+     */
+    [[nodiscard]] static constexpr std::optional<basic_fixed>
+    checked_create(const Integer whole) noexcept
+    {
+        const auto raw = whole.checked_mul(Integer(scale));
+        return raw ? std::optional(from_raw(*raw)) : std::nullopt;
+    }
+
+    /**
+     * @brief saturating_create
+     * @return whole as a fixed point number, clamped to MIN()/MAX().
+     */
+    [[nodiscard]] static constexpr basic_fixed
+    saturating_create(const Integer whole) noexcept
+    {
+        return from_raw(whole.saturating_mul(Integer(scale)));
+    }
+
+    /**
+     * @return the smallest value
+     */
+    [[nodiscard]] static constexpr basic_fixed
+    MIN() noexcept
+    {
+        return from_raw(Integer::MIN());
+    }
+
+    /**
+     * @return the largest value
+     */
+    [[nodiscard]] static constexpr basic_fixed
+    MAX() noexcept
+    {
+        return from_raw(Integer::MAX());
+    }
+
+    /**
+     * @return the smallest positive value, 1 / scale
+     */
+    [[nodiscard]] static constexpr basic_fixed
+    EPSILON() noexcept
+    {
+        return from_raw(Integer(integer_type(1)));
+    }
+
+    /**
+     * @return the raw scaled value
+     */
+    [[nodiscard]] constexpr Integer
+    raw() const noexcept
+    {
+        return this->value_;
+    }
+
+    /**
+     * @brief trunc
+     * @return the integer part, rounded towards zero.
+     */
+    [[nodiscard]] constexpr Integer
+    trunc() const noexcept
+    {
+        return Integer(integer_type(this->value_.data() / scale));
+    }
+
+    /**
+     * @brief round
+     * @return the nearest integer, ties to even.
+     */
+    [[nodiscard]] constexpr Integer
+    round() const noexcept
+    {
+        return Integer(detail::fixed::round_div(this->value_.data(), scale));
+    }
+
+    // checked
+
+    /**
+     * @brief checked_add - Checked fixed point addition
+     * @return self + rhs, or std::nullopt if overflow occurred.
+     */
+    [[nodiscard]] constexpr std::optional<basic_fixed>
+    checked_add(const basic_fixed rhs) const noexcept
+    {
+        const auto r = this->value_.checked_add(rhs.value_);
+        return r ? std::optional(from_raw(*r)) : std::nullopt;
+    }
+
+    /**
+     * @brief checked_sub - Checked fixed point subtraction
+     * @return self - rhs, or std::nullopt if overflow occurred.
+     */
+    [[nodiscard]] constexpr std::optional<basic_fixed>
+    checked_sub(const basic_fixed rhs) const noexcept
+    {
+        const auto r = this->value_.checked_sub(rhs.value_);
+        return r ? std::optional(from_raw(*r)) : std::nullopt;
+    }
+
+    /**
+     * @brief checked_mul - Checked fixed point multiplication
+     * @return self * rhs rounded to nearest, or std::nullopt if overflow occurred.
+     */
+    [[nodiscard]] constexpr std::optional<basic_fixed>
+    checked_mul(const basic_fixed rhs) const noexcept
+    {
+        const auto [result, overflow] = narrow(this->wide_mul(rhs));
+        return overflow ? std::nullopt : std::optional(result);
+    }
+
+    /**
+     * @brief checked_div - Checked fixed point division
+     * @return self / rhs rounded to nearest, or std::nullopt if rhs == 0 or overflow occurred.
+     */
+    [[nodiscard]] constexpr std::optional<basic_fixed>
+    checked_div(const basic_fixed rhs) const noexcept
+    {
+        if (rhs.value_ == 0)
+        {
+            return std::nullopt;
+        }
+        const auto [result, overflow] = narrow(this->wide_div(rhs));
+        return overflow ? std::nullopt : std::optional(result);
+    }
+
+    // saturating
+
+    /**
+     * @brief saturating_add - Saturating fixed point addition
+     * @return self + rhs, instead of overflowing will return MIN()/MAX().
+     */
+    [[nodiscard]] constexpr basic_fixed
+    saturating_add(const basic_fixed rhs) const noexcept
+    {
+        return from_raw(this->value_.saturating_add(rhs.value_));
+    }
+
+    /**
+     * @brief saturating_sub - Saturating fixed point subtraction
+     * @return self - rhs, instead of overflowing will return MIN()/MAX().
+     */
+    [[nodiscard]] constexpr basic_fixed
+    saturating_sub(const basic_fixed rhs) const noexcept
+    {
+        return from_raw(this->value_.saturating_sub(rhs.value_));
+    }
+
+    /**
+     * @brief saturating_mul - Saturating fixed point multiplication
+     * @return self * rhs rounded to nearest, instead of overflowing will return MIN()/MAX().
+     */
+    [[nodiscard]] constexpr basic_fixed
+    saturating_mul(const basic_fixed rhs) const noexcept
+    {
+        return clamp(this->wide_mul(rhs));
+    }
+
+    /**
+     * @brief saturating_div - Saturating fixed point division
+     * @return self / rhs rounded to nearest, instead of overflowing will return MIN()/MAX().
+     * Panics if rhs == 0.
+     */
+    [[nodiscard]] constexpr basic_fixed
+    saturating_div(const basic_fixed rhs) const noexcept
+    {
+        ztd::panic_if(rhs.value_ == 0, "attempt to divide by zero");
+        return clamp(this->wide_div(rhs));
+    }
+
+    // wrapping
+
+    /**
+     * @brief wrapping_add - Wrapping (modular) fixed point addition
+     * @return self + rhs, wrapping around at the boundary of the type.
+     */
+    [[nodiscard]] constexpr basic_fixed
+    wrapping_add(const basic_fixed rhs) const noexcept
+    {
+        return from_raw(this->value_.wrapping_add(rhs.value_));
+    }
+
+    /**
+     * @brief wrapping_sub - Wrapping (modular) fixed point subtraction
+     * @return self - rhs, wrapping around at the boundary of the type.
+     */
+    [[nodiscard]] constexpr basic_fixed
+    wrapping_sub(const basic_fixed rhs) const noexcept
+    {
+        return from_raw(this->value_.wrapping_sub(rhs.value_));
+    }
+
+    /**
+     * @brief wrapping_mul - Wrapping (modular) fixed point multiplication
+     * @return self * rhs rounded to nearest, wrapping around at the boundary of the type.
+     */
+    [[nodiscard]] constexpr basic_fixed
+    wrapping_mul(const basic_fixed rhs) const noexcept
+    {
+        return std::get<0>(narrow(this->wide_mul(rhs)));
+    }
+
+    /**
+     * @brief wrapping_div - Wrapping (modular) fixed point division
+     * @return self / rhs rounded to nearest, wrapping around at the boundary of the type.
+     * Panics if rhs == 0.
+     */
+    [[nodiscard]] constexpr basic_fixed
+    wrapping_div(const basic_fixed rhs) const noexcept
+    {
+        ztd::panic_if(rhs.value_ == 0, "attempt to divide by zero");
+        return std::get<0>(narrow(this->wide_div(rhs)));
+    }
+
+    // strict
+
+    /**
+     * @brief strict_add - Strict fixed point addition
+     * @return self + rhs, panics on overflow.
+     */
+    [[nodiscard]] constexpr basic_fixed
+    strict_add(const basic_fixed rhs) const noexcept
+    {
+        return from_raw(this->value_.strict_add(rhs.value_));
+    }
+
+    /**
+     * @brief strict_sub - Strict fixed point subtraction
+     * @return self - rhs, panics on overflow.
+     */
+    [[nodiscard]] constexpr basic_fixed
+    strict_sub(const basic_fixed rhs) const noexcept
+    {
+        return from_raw(this->value_.strict_sub(rhs.value_));
+    }
+
+    /**
+     * @brief strict_mul - Strict fixed point multiplication
+     * @return self * rhs rounded to nearest, panics on overflow.
+     */
+    [[nodiscard]] constexpr basic_fixed
+    strict_mul(const basic_fixed rhs) const noexcept
+    {
+        const auto [result, overflow] = narrow(this->wide_mul(rhs));
+        ztd::panic_if(overflow, "attempt to multiply with overflow");
+        return result;
+    }
+
+    /**
+     * @brief strict_div - Strict fixed point division
+     * @return self / rhs rounded to nearest, panics on overflow or if rhs == 0.
+     */
+    [[nodiscard]] constexpr basic_fixed
+    strict_div(const basic_fixed rhs) const noexcept
+    {
+        ztd::panic_if(rhs.value_ == 0, "attempt to divide by zero");
+        const auto [result, overflow] = narrow(this->wide_div(rhs));
+        ztd::panic_if(overflow, "attempt to divide with overflow");
+        return result;
+    }
+
+    // default math mode
+
+    /**
+     * @brief add - fixed point addition
+     * @return self + rhs, side effects determined by default math mode.
+     */
+    [[nodiscard]] constexpr basic_fixed
+    add(const basic_fixed rhs) const noexcept
+    {
+        return from_raw(this->value_.add(rhs.value_));
+    }
+
+    /**
+     * @brief sub - fixed point subtraction
+     * @return self - rhs, side effects determined by default math mode.
+     */
+    [[nodiscard]] constexpr basic_fixed
+    sub(const basic_fixed rhs) const noexcept
+    {
+        return from_raw(this->value_.sub(rhs.value_));
+    }
+
+    /**
+     * @brief mul - fixed point multiplication
+     * @return self * rhs rounded to nearest, side effects determined by default math mode.
+     */
+    [[nodiscard]] constexpr basic_fixed
+    mul(const basic_fixed rhs) const noexcept
+    {
+        if constexpr (std::same_as<detail::default_math, detail::math_strict>)
+        {
+            return this->strict_mul(rhs);
+        }
+        else
+        {
+            return this->wrapping_mul(rhs);
+        }
+    }
+
+    /**
+     * @brief div - fixed point division
+     * @return self / rhs rounded to nearest, side effects determined by default math mode.
+     */
+    [[nodiscard]] constexpr basic_fixed
+    div(const basic_fixed rhs) const noexcept
+    {
+        if constexpr (std::same_as<detail::default_math, detail::math_strict>)
+        {
+            return this->strict_div(rhs);
+        }
+        else
+        {
+            return this->wrapping_div(rhs);
+        }
+    }
+
+    // unary operators
+
+    [[nodiscard]] constexpr basic_fixed
+    operator+() const noexcept
+        requires(detail::is_signed_integer<integer_type>)
+    {
+        return *this;
+    }
+
+    [[nodiscard]] constexpr basic_fixed
+    operator-() const noexcept
+        requires(detail::is_signed_integer<integer_type>)
+    {
+        return from_raw(-this->value_);
+    }
+
+    // arithmetic operators
+
+    [[nodiscard]] friend constexpr basic_fixed
+    operator+(const basic_fixed lhs, const basic_fixed rhs) noexcept
+    {
+        return lhs.add(rhs);
+    }
+
+    [[nodiscard]] friend constexpr basic_fixed
+    operator-(const basic_fixed lhs, const basic_fixed rhs) noexcept
+    {
+        return lhs.sub(rhs);
+    }
+
+    [[nodiscard]] friend constexpr basic_fixed
+    operator*(const basic_fixed lhs, const basic_fixed rhs) noexcept
+    {
+        return lhs.mul(rhs);
+    }
+
+    [[nodiscard]] friend constexpr basic_fixed
+    operator/(const basic_fixed lhs, const basic_fixed rhs) noexcept
+    {
+        return lhs.div(rhs);
+    }
+
+    // scaling by a whole number, i.e. price * quantity, is exact.
+    [[nodiscard]] friend constexpr basic_fixed
+    operator*(const basic_fixed lhs, const Integer rhs) noexcept
+    {
+        return from_raw(lhs.value_ * rhs);
+    }
+
+    [[nodiscard]] friend constexpr basic_fixed
+    operator*(const Integer lhs, const basic_fixed rhs) noexcept
+    {
+        return from_raw(lhs * rhs.value_);
+    }
+
+    // rounded to nearest, ties to even. The raw value is divided, so rhs does
+    // not have to fit at the scale of basic_fixed.
+    [[nodiscard]] friend constexpr basic_fixed
+    operator/(const basic_fixed lhs, const Integer rhs) noexcept
+    {
+        ztd::panic_if(rhs == 0, "attempt to divide by zero");
+        if constexpr (std::same_as<detail::default_math, detail::math_strict>)
+        {
+            const auto [result, overflow] = narrow(lhs.wide_div(rhs));
+            ztd::panic_if(overflow, "attempt to divide with overflow");
+            return result;
+        }
+        else
+        {
+            return std::get<0>(narrow(lhs.wide_div(rhs)));
+        }
+    }
+
+    // assignment operators
+
+    constexpr basic_fixed&
+    operator+=(const basic_fixed rhs) noexcept
+    {
+        *this = *this + rhs;
+        return *this;
+    }
+
+    constexpr basic_fixed&
+    operator-=(const basic_fixed rhs) noexcept
+    {
+        *this = *this - rhs;
+        return *this;
+    }
+
+    constexpr basic_fixed&
+    operator*=(const basic_fixed rhs) noexcept
+    {
+        *this = *this * rhs;
+        return *this;
+    }
+
+    constexpr basic_fixed&
+    operator/=(const basic_fixed rhs) noexcept
+    {
+        *this = *this / rhs;
+        return *this;
+    }
+
+    constexpr basic_fixed&
+    operator*=(const Integer rhs) noexcept
+    {
+        *this = *this * rhs;
+        return *this;
+    }
+
+    constexpr basic_fixed&
+    operator/=(const Integer rhs) noexcept
+    {
+        *this = *this / rhs;
+        return *this;
+    }
+
+    // comparison operators
+
+    [[nodiscard]] friend constexpr bool
+    operator==(const basic_fixed lhs, const basic_fixed rhs) noexcept
+    {
+        return lhs.value_ == rhs.value_;
+    }
+
+    [[nodiscard]] friend constexpr std::strong_ordering
+    operator<=>(const basic_fixed lhs, const basic_fixed rhs) noexcept
+    {
+        return lhs.value_.data() <=> rhs.value_.data();
+    }
+
+#if defined(ZTD_TEST_SUITE)
+    // needed for doctest to show values
+    friend std::ostream&
+    operator<<(std::ostream& os, const basic_fixed obj)
+    {
+        std::array<char, max_chars> buffer;
+        const auto [ptr, ec] = to_chars(buffer.data(), buffer.data() + buffer.size(), obj);
+        os << std::string_view(buffer.data(), ptr);
+        return os;
+    }
+#endif
+
+    /**
+     * @brief max_chars - the longest string to_chars() can write
+     */
+    static constexpr std::size_t max_chars = 1 + 20 + 1 + std::size_t(Digits);
+
+    /**
+     * @brief to_chars
+     *
+     *  - Write the value as a decimal number into [first, last), with the same
+     *    contract as std::to_chars. Decimals write exactly Digits fractional
+     *    digits, i.e. "12.50". Binary fixed point writes the exact value with
+     *    no trailing zeros, i.e. "0.375".
+     *
+     * @return std::to_chars_result
+     */
+    [[nodiscard]] friend constexpr std::to_chars_result
+    to_chars(char* first, char* last, const basic_fixed value) noexcept
+    {
+        using unsigned_type = std::make_unsigned_t<integer_type>;
+
+        const auto raw = value.value_.data();
+        const bool negative = raw < 0;
+        const auto u = unsigned_type(raw);
+        const auto magnitude = negative ? unsigned_type(unsigned_type(0) - u) : u;
+
+        const auto whole = std::uint64_t(magnitude / unsigned_type(scale));
+        auto frac = std::uint64_t(magnitude % unsigned_type(scale));
+
+        std::size_t frac_digits = 0;
+        if constexpr (Radix == 10)
+        {
+            frac_digits = std::size_t(Digits);
+        }
+        else if (frac != 0)
+        {
+            // frac / 2^Digits has exactly one decimal digit per fractional bit
+            frac_digits = std::size_t(Digits - std::countr_zero(frac));
+        }
+
+        const auto length = std::size_t(negative ? 1 : 0) +
+                            detail::charconv::count_digits(whole) +
+                            (frac_digits != 0 ? 1 + frac_digits : 0);
+        if (std::size_t(last - first) < length)
+        {
+            return {last, std::errc::value_too_large};
+        }
+
+        if (negative)
+        {
+            *first++ = '-';
+        }
+        first = detail::charconv::to_chars(first, last, whole).ptr;
+        if (frac_digits == 0)
+        {
+            return {first, std::errc()};
+        }
+
+        *first++ = '.';
+        if constexpr (Radix == 10)
+        {
+            for (auto i = frac_digits; i > 0; --i)
+            {
+                first[i - 1] = char('0' + frac % 10);
+                frac /= 10;
+            }
+            first += frac_digits;
+        }
+        else
+        {
+            using wide = detail::divide::uint128;
+            constexpr auto mask = (wide(1) << Digits) - 1;
+
+            auto rest = wide(frac);
+            for (std::size_t i = 0; i < frac_digits; ++i)
+            {
+                rest *= 10;
+                *first++ = char('0' + int(rest >> Digits));
+                rest &= mask;
+            }
+        }
+        return {first, std::errc()};
+    }
+
+    /**
+     * @brief from_chars
+     *
+     *  - Read a decimal number, i.e. "-12.345", from [first, last), with the
+     *    same contract as std::from_chars. Fractional digits beyond what the
+     *    type can hold are rounded to nearest, ties to even.
+     *
+     * @return std::from_chars_result
+     */
+    [[nodiscard]] friend constexpr std::from_chars_result
+    from_chars(const char* first, const char* last, basic_fixed& value) noexcept
+    {
+        using unsigned_type = std::make_unsigned_t<integer_type>;
+        using wide = detail::divide::uint128;
+
+        // Every midpoint between two raw values is a multiple of 2^-(Digits + 1)
+        // or 5 * 10^-(Digits + 1), so of 10^-(Digits + 1). These many digits
+        // decide on which side of a midpoint the value is, the digits past them
+        // only whether a value exactly on it is above it.
+        constexpr std::size_t max_frac_digits = std::size_t(Digits) + 1;
+
+        const char* ptr = first;
+        bool negative = false;
+        if constexpr (detail::is_signed_integer<integer_type>)
+        {
+            if (ptr != last && *ptr == '-')
+            {
+                negative = true;
+                ++ptr;
+            }
+        }
+
+        const auto [int_end, whole, overflow] = detail::charconv::parse_unsigned(ptr, last, 10);
+        bool any_digits = int_end != ptr;
+        ptr = int_end;
+
+        std::array<std::uint8_t, max_frac_digits> frac{};
+        std::size_t frac_digits = 0;
+        bool sticky = false;
+        if (ptr != last && *ptr == '.')
+        {
+            const char* frac_begin = ++ptr;
+            for (; ptr != last; ++ptr)
+            {
+                const auto d = std::uint32_t(static_cast<unsigned char>(*ptr) - '0');
+                if (d >= 10)
+                {
+                    break;
+                }
+                if (frac_digits < max_frac_digits)
+                {
+                    frac[frac_digits++] = std::uint8_t(d);
+                }
+                else
+                {
+                    sticky |= d != 0;
+                }
+            }
+            any_digits |= ptr != frac_begin;
+        }
+
+        if (!any_digits)
+        {
+            return {first, std::errc::invalid_argument};
+        }
+
+        // scaled = floor(0.frac * scale), and on which side of the half ulp
+        // after it the rest of the value is
+        wide scaled = 0;
+        auto rest = std::strong_ordering::less;
+        if constexpr (Radix == 10)
+        {
+            for (std::size_t i = 0; i < std::size_t(Digits); ++i)
+            {
+                scaled = scaled * 10 + frac[i];
+            }
+            const int next = frac[std::size_t(Digits)];
+            rest = next != 5 ? next <=> 5
+                             : (sticky ? std::strong_ordering::greater : std::strong_ordering::equal);
+        }
+        else
+        {
+            // long multiplication of the digits by 2, the carry out of the
+            // first digit is the next bit
+            for (std::size_t bit = 0; bit <= std::size_t(Digits); ++bit)
+            {
+                std::uint32_t carry = 0;
+                for (std::size_t i = frac.size(); i-- != 0;)
+                {
+                    const auto v = std::uint32_t(frac[i]) * 2 + carry;
+                    frac[i] = std::uint8_t(v % 10);
+                    carry = v / 10;
+                }
+                if (bit < std::size_t(Digits))
+                {
+                    scaled = (scaled << 1) | carry;
+                }
+                else if (carry != 0)
+                {
+                    const bool more =
+                        sticky || std::ranges::any_of(frac, [](const auto d) { return d != 0; });
+                    rest = more ? std::strong_ordering::greater : std::strong_ordering::equal;
+                }
+            }
+        }
+        // rounded to nearest, ties to even
+        if (rest > 0 || (rest == 0 && (scaled & 1) != 0))
+        {
+            ++scaled;
+        }
+
+        const auto magnitude = wide(whole) * wide(unsigned_type(scale)) + scaled;
+        const auto limit =
+            wide(unsigned_type(std::numeric_limits<integer_type>::max())) + (negative ? 1 : 0);
+        if (overflow || magnitude > limit)
+        {
+            return {ptr, std::errc::result_out_of_range};
+        }
+
+        const auto u = unsigned_type(magnitude);
+        value = from_raw(Integer(integer_type(negative ? unsigned_type(unsigned_type(0) - u) : u)));
+        return {ptr, std::errc()};
+    }
+
+  private:
+    using wide_type = detail::fixed::wide_t<integer_type>;
+
+    /**
+     * @return self * rhs / scale in the wide type, rounded to nearest
+     */
+    [[nodiscard]] constexpr wide_type
+    wide_mul(const basic_fixed rhs) const noexcept
+    {
+        const auto product = wide_type(this->value_.data()) * wide_type(rhs.value_.data());
+        return detail::fixed::round_div(product, wide_type(scale));
+    }
+
+    /**
+     * @return self * scale / rhs in the wide type, rounded to nearest. rhs must not be zero.
+     */
+    [[nodiscard]] constexpr wide_type
+    wide_div(const basic_fixed rhs) const noexcept
+    {
+        auto n = wide_type(wide_type(this->value_.data()) * wide_type(scale));
+        auto d = wide_type(rhs.value_.data());
+        if constexpr (detail::is_signed_integer<integer_type>)
+        {
+            if (d < 0)
+            {
+                n = wide_type(-n);
+                d = wide_type(-d);
+            }
+        }
+        return detail::fixed::round_div(n, d);
+    }
+
+    /**
+     * @return self / rhs in the wide type, rounded to nearest. rhs must not be zero.
+     */
+    [[nodiscard]] constexpr wide_type
+    wide_div(const Integer rhs) const noexcept
+    {
+        auto n = wide_type(this->value_.data());
+        auto d = wide_type(rhs.data());
+        if constexpr (detail::is_signed_integer<integer_type>)
+        {
+            if (d < 0)
+            {
+                n = wide_type(-n);
+                d = wide_type(-d);
+            }
+        }
+        return detail::fixed::round_div(n, d);
+    }
+
+    /**
+     * @return v wrapped around at the boundary of the type, and if it was out of range
+     */
+    [[nodiscard]] static constexpr std::tuple<basic_fixed, bool>
+    narrow(const wide_type v) noexcept
+    {
+        const auto result = integer_type(v);
+        return {from_raw(Integer(result)), wide_type(result) != v};
+    }
+
+    /**
+     * @return v clamped to MIN()/MAX()
+     */
+    [[nodiscard]] static constexpr basic_fixed
+    clamp(const wide_type v) noexcept
+    {
+        constexpr auto min = wide_type(std::numeric_limits<integer_type>::min());
+        constexpr auto max = wide_type(std::numeric_limits<integer_type>::max());
+        return from_raw(Integer(integer_type(std::clamp(v, min, max))));
+    }
+
+    Integer value_;
+};
+
+template<typename Integer, int FracBits> using fixed = basic_fixed<Integer, 2, FracBits>;
+template<typename Integer, int Scale> using decimal = basic_fixed<Integer, 10, Scale>;
+} // namespace ztd
+
+// std::format
+template<typename Integer, int Radix, int Digits>
+struct std::formatter<ztd::basic_fixed<Integer, Radix, Digits>> : std::formatter<std::string_view>
+{
+    auto
+    format(const ztd::basic_fixed<Integer, Radix, Digits>& obj, std::format_context& ctx) const
+    {
+        using type = ztd::basic_fixed<Integer, Radix, Digits>;
+
+        std::array<char, type::max_chars> buffer;
+        const auto [ptr, ec] = to_chars(buffer.data(), buffer.data() + buffer.size(), obj);
+        return std::formatter<std::string_view>::format(std::string_view(buffer.data(), ptr), ctx);
+    }
+};
+
+// std::hash
+template<typename Integer, int Radix, int Digits>
+struct std::hash<ztd::basic_fixed<Integer, Radix, Digits>>
+{
+    typename Integer::integer_type
+    operator()(const ztd::basic_fixed<Integer, Radix, Digits>& obj) const
+    {
+        return std::hash<Integer>()(obj.raw());
+    }
+};
@@ -56,6 +56,8 @@ template<typename T, typename U> constexpr bool is_integer_conversion_safe =
 // clang-format on
 } // namespace detail
 
+template<typename Integer> class divider;
+
 template<typename Tag> class integer final
 {
   public:
@@ -219,11 +221,7 @@ template<typename Tag> class integer final
     [[nodiscard]] static constexpr integer<Tag>
     random() noexcept
     {
-        static std::uniform_int_distribution<integer_type> dist(
-            std::numeric_limits<integer_type>::min(),
-            std::numeric_limits<integer_type>::max());
-
-        return integer<Tag>(dist(detail::rng()));
+        return integer<Tag>(ztd::random<integer_type>());
     }
 
     /**
@@ -238,6 +236,34 @@ template<typename Tag> class integer final
         return integer<Tag>(ztd::random(min.value_, max.value_));
     }
 
+    /**
+     * @brief random - get a random value between (MIN, MAX)
+     * @param[in,out] context The context to draw from, i.e. a ztd::random_context
+     * @return a random value
+     */
+    template<typename Context>
+    [[nodiscard]] static constexpr integer<Tag>
+    random(Context& context) noexcept
+        requires(detail::prng::is_engine64<Context>)
+    {
+        return integer<Tag>(ztd::random<integer_type>(context));
+    }
+
+    /**
+     * @brief random - get a random value between (min, max)
+     * @param[in,out] context The context to draw from, i.e. a ztd::random_context
+     * @param[in] min min random value
+     * @param[in] max max random value
+     * @return a random value
+     */
+    template<typename Context>
+    [[nodiscard]] static constexpr integer<Tag>
+    random(Context& context, const integer<Tag> min, const integer<Tag> max) noexcept
+        requires(detail::prng::is_engine64<Context>)
+    {
+        return integer<Tag>(ztd::random(context, min.value_, max.value_));
+    }
+
     // conversions operators
 
     explicit operator bool() = delete ("help: use either '!= 0' or '== 0'");
@@ -369,6 +395,18 @@ template<typename Tag> class integer final
         return this->rem(x);
     }
 
+    [[nodiscard]] constexpr integer<Tag>
+    operator/(const divider<integer<Tag>>& rhs) const noexcept
+    {
+        return rhs.div(*this);
+    }
+
+    [[nodiscard]] constexpr integer<Tag>
+    operator%(const divider<integer<Tag>>& rhs) const noexcept
+    {
+        return rhs.rem(*this);
+    }
+
     // assignment operators
 
     constexpr integer<Tag>&
@@ -456,6 +494,20 @@ template<typename Tag> class integer final
         return *this;
     }
 
+    constexpr integer<Tag>&
+    operator/=(const divider<integer<Tag>>& rhs) noexcept
+    {
+        *this = rhs.div(*this);
+        return *this;
+    }
+
+    constexpr integer<Tag>&
+    operator%=(const divider<integer<Tag>>& rhs) noexcept
+    {
+        *this = rhs.rem(*this);
+        return *this;
+    }
+
     // comparison operators
 
     template<typename T>
@@ -792,6 +844,66 @@ template<typename Tag> class integer final
         }
     }
 
+    /**
+     * @brief div - integer division by a precomputed divisor
+     * @return self / rhs, side effects determined by default math mode.
+     */
+    [[nodiscard]] constexpr integer<Tag>
+    div(const divider<integer<Tag>>& rhs) const noexcept
+    {
+        return rhs.div(*this);
+    }
+
+    /**
+     * @brief div_floor - integer division by a precomputed divisor
+     * @return self / rhs, rounded towards negative infinity, side effects determined by default math mode.
+     */
+    [[nodiscard]] constexpr integer<Tag>
+    div_floor(const divider<integer<Tag>>& rhs) const noexcept
+    {
+        return rhs.div_floor(*this);
+    }
+
+    /**
+     * @brief div_ceil - integer division by a precomputed divisor
+     * @return self / rhs, rounded towards positive infinity, side effects determined by default math mode.
+     */
+    [[nodiscard]] constexpr integer<Tag>
+    div_ceil(const divider<integer<Tag>>& rhs) const noexcept
+    {
+        return rhs.div_ceil(*this);
+    }
+
+    /**
+     * @brief div_euclid - euclidean division by a precomputed divisor
+     * @return self / rhs, side effects determined by default math mode.
+     */
+    [[nodiscard]] constexpr integer<Tag>
+    div_euclid(const divider<integer<Tag>>& rhs) const noexcept
+    {
+        return rhs.div_euclid(*this);
+    }
+
+    /**
+     * @brief rem - integer remainder by a precomputed divisor
+     * @return self % rhs, side effects determined by default math mode.
+     */
+    [[nodiscard]] constexpr integer<Tag>
+    rem(const divider<integer<Tag>>& rhs) const noexcept
+    {
+        return rhs.rem(*this);
+    }
+
+    /**
+     * @brief rem_euclid - euclidean remainder by a precomputed divisor
+     * @return self % rhs, side effects determined by default math mode.
+     */
+    [[nodiscard]] constexpr integer<Tag>
+    rem_euclid(const divider<integer<Tag>>& rhs) const noexcept
+    {
+        return rhs.rem_euclid(*this);
+    }
+
     /**
      * @brief neg - integer negation
      * @return -self, side effects determined by default math mode.
@@ -846,7 +958,7 @@ template<typename Tag> class integer final
      * @brief checked_add - Checked integer addition
      * @return self + rhs, or std::nullopt if a overflow, underflow, or other error occured.
      */
-    [[nodiscard]] constexpr std::optional<integer<Tag>>
+    [[nodiscard]] [[gnu::always_inline]] constexpr std::optional<integer<Tag>>
     checked_add(const integer<Tag> rhs) const noexcept
     {
         auto [result, overflow] = this->overflowing_add(rhs);
@@ -861,7 +973,7 @@ template<typename Tag> class integer final
      * @brief checked_add - Checked integer addition
      * @return self + rhs, or std::nullopt if a overflow, underflow, or other error occured.
      */
-    [[nodiscard]] constexpr std::optional<integer<Tag>>
+    [[nodiscard]] [[gnu::always_inline]] constexpr std::optional<integer<Tag>>
     checked_add(const integer<sign_conversion> rhs) const noexcept
     {
         auto [result, overflow] = this->overflowing_add(rhs);
@@ -876,7 +988,7 @@ template<typename Tag> class integer final
      * @brief checked_sub - Checked integer subtraction
      * @return self - rhs, or std::nullopt if a overflow, underflow, or other error occured.
      */
-    [[nodiscard]] constexpr std::optional<integer<Tag>>
+    [[nodiscard]] [[gnu::always_inline]] constexpr std::optional<integer<Tag>>
     checked_sub(const integer<Tag> rhs) const noexcept
     {
         auto [result, overflow] = this->overflowing_sub(rhs);
@@ -891,7 +1003,7 @@ template<typename Tag> class integer final
      * @brief checked_sub - Checked integer subtraction
      * @return self - rhs, or std::nullopt if a overflow, underflow, or other error occured.
      */
-    [[nodiscard]] constexpr std::optional<integer<Tag>>
+    [[nodiscard]] [[gnu::always_inline]] constexpr std::optional<integer<Tag>>
     checked_sub(const integer<sign_conversion> rhs) const noexcept
     {
         auto [result, overflow] = this->overflowing_sub(rhs);
@@ -906,7 +1018,7 @@ template<typename Tag> class integer final
      * @brief checked_mul - Checked integer multiplication
      * @return self * rhs, or std::nullopt if a overflow, underflow, or other error occured.
      */
-    [[nodiscard]] constexpr std::optional<integer<Tag>>
+    [[nodiscard]] [[gnu::always_inline]] constexpr std::optional<integer<Tag>>
     checked_mul(const integer<Tag> rhs) const noexcept
     {
         auto [result, overflow] = this->overflowing_mul(rhs);
@@ -1309,7 +1421,7 @@ template<typename Tag> class integer final
         }
 
         auto result = integer<Tag>::unchecked_create(1);
-        for (const auto _ : std::views::iota(0ul, exp.value_))
+        for (const auto _ : std::views::iota(0u, exp.value_))
         {
             result = this->saturating_mul(result);
         }
@@ -1601,14 +1713,8 @@ template<typename Tag> class integer final
     {
         panic_if(rhs == 0, panic_type::div_zero);
 
-        if constexpr (detail::is_signed_integer<integer_type>)
-        {
-            if (rhs == -1 && *this == integer<Tag>::MIN())
-            {
-                return {integer<Tag>::MIN(), true};
-            }
-        }
-        return {integer<Tag>(integer_type(this->value_ / rhs.value_)), false};
+        const auto [divisor, overflow] = this->overflowing_divisor(rhs);
+        return {integer<Tag>(integer_type(this->value_ / divisor)), overflow};
     }
 
     /**
@@ -1634,21 +1740,21 @@ template<typename Tag> class integer final
     {
         panic_if(rhs == 0, panic_type::div_zero);
 
+        const auto [divisor, overflow] = this->overflowing_divisor(rhs);
+        const auto d = integer_type(this->value_ / divisor);
+        const auto r = integer_type(this->value_ % divisor);
+
         if constexpr (detail::is_signed_integer<integer_type>)
         {
-            if (rhs == -1 && *this == integer<Tag>::MIN())
-            {
-                return {integer<Tag>::MIN(), true};
-            }
+            // r has the sign of self, so r ^ divisor is negative when the quotient is
+            const auto quotient_sign = integer_type(sign_mask(integer_type(r ^ divisor)) | 1);
+            const auto adjust = integer_type(nonzero_mask(r) & quotient_sign);
+            return {integer<Tag>(integer_type(d + adjust)), overflow};
+        }
+        else
+        {
+            return {integer<Tag>(integer_type(d + (r != 0))), overflow};
         }
-
-        auto d = this->value_ / rhs.value_;
-        auto r = this->value_ % rhs.value_;
-
-        auto quotient_sign = this->signum() * rhs.signum();
-        auto result = d + ((r != 0) * quotient_sign.value_);
-
-        return {integer<Tag>(integer_type(result)), false};
     }
 
     /**
@@ -1661,21 +1767,21 @@ template<typename Tag> class integer final
     {
         panic_if(rhs == 0, panic_type::div_zero);
 
+        const auto [divisor, overflow] = this->overflowing_divisor(rhs);
+        const auto d = integer_type(this->value_ / divisor);
+
         if constexpr (detail::is_signed_integer<integer_type>)
         {
-            if (rhs == -1 && *this == integer<Tag>::MIN())
-            {
-                return {integer<Tag>::MIN(), true};
-            }
+            const auto r = integer_type(this->value_ % divisor);
+            // -1 if there is a remainder and the quotient is negative
+            const auto adjust =
+                integer_type(nonzero_mask(r) & sign_mask(integer_type(r ^ divisor)));
+            return {integer<Tag>(integer_type(d + adjust)), overflow};
+        }
+        else
+        {
+            return {integer<Tag>(d), overflow};
         }
-
-        auto d = this->value_ / rhs.value_;
-        auto r = this->value_ % rhs.value_;
-
-        auto quotient_negative = (*this < 0) != (rhs < 0);
-        auto result = d - (r != 0 && quotient_negative);
-
-        return {integer<Tag>(integer_type(result)), false};
     }
 
     /**
@@ -1688,21 +1794,21 @@ template<typename Tag> class integer final
     {
         panic_if(rhs == 0, panic_type::div_zero);
 
+        const auto [divisor, overflow] = this->overflowing_divisor(rhs);
+        const auto d = integer_type(this->value_ / divisor);
+        const auto r = integer_type(this->value_ % divisor);
+
         if constexpr (detail::is_signed_integer<integer_type>)
         {
-            if (rhs == -1 && *this == integer<Tag>::MIN())
-            {
-                return {integer<Tag>::MIN(), true};
-            }
+            // 1 if there is a remainder and the quotient is positive
+            const auto adjust =
+                integer_type(nonzero_mask(r) & ~sign_mask(integer_type(r ^ divisor)) & 1);
+            return {integer<Tag>(integer_type(d + adjust)), overflow};
+        }
+        else
+        {
+            return {integer<Tag>(integer_type(d + (r != 0))), overflow};
         }
-
-        auto d = this->value_ / rhs.value_;
-        auto r = this->value_ % rhs.value_;
-
-        auto quotient_positive = (*this < 0) == (rhs < 0);
-        auto result = d + (r != 0 && quotient_positive);
-
-        return {integer<Tag>(integer_type(result)), false};
     }
 
     /**
@@ -1715,18 +1821,19 @@ template<typename Tag> class integer final
     {
         panic_if(rhs == 0, panic_type::div_zero);
 
+        const auto [divisor, overflow] = this->overflowing_divisor(rhs);
+        const auto d = integer_type(this->value_ / divisor);
+
         if constexpr (detail::is_signed_integer<integer_type>)
         {
-            if (rhs == -1 && *this == integer<Tag>::MIN())
-            {
-                return {integer<Tag>::MIN(), true};
-            }
-
-            return rhs < 0 ? this->overflowing_div_ceil(rhs) : this->overflowing_div_floor(rhs);
+            const auto r = integer_type(this->value_ % divisor);
+            // a negative remainder moves the quotient one step away from the sign of rhs
+            const auto adjust = integer_type(sign_mask(r) & (sign_mask(divisor) | 1));
+            return {integer<Tag>(integer_type(d - adjust)), overflow};
         }
         else
         {
-            return this->overflowing_div_floor(rhs);
+            return {integer<Tag>(d), overflow};
         }
     }
 
@@ -1739,14 +1846,8 @@ template<typename Tag> class integer final
     {
         panic_if(rhs == 0, panic_type::rem_zero);
 
-        if constexpr (detail::is_signed_integer<integer_type>)
-        {
-            if (rhs == -1 && *this == integer<Tag>::MIN())
-            {
-                return {integer<Tag>(integer_type(0)), true};
-            }
-        }
-        return {integer<Tag>(integer_type(this->value_ % rhs.value_)), false};
+        const auto [divisor, overflow] = this->overflowing_divisor(rhs);
+        return {integer<Tag>(integer_type(this->value_ % divisor)), overflow};
     }
 
     /**
@@ -1758,33 +1859,23 @@ template<typename Tag> class integer final
     {
         panic_if(rhs == 0, panic_type::rem_zero);
 
+        const auto [divisor, overflow] = this->overflowing_divisor(rhs);
+        const auto r = integer_type(this->value_ % divisor);
+
         if constexpr (detail::is_signed_integer<integer_type>)
         {
-            if (rhs == -1 && *this == integer<Tag>::MIN())
-            {
-                return {integer<Tag>(integer_type(0)), true};
-            }
+            using unsigned_type = std::make_unsigned_t<integer_type>;
 
-            auto r = this->rem(rhs);
-            if (r < 0)
-            {
-                if (rhs < 0)
-                {
-                    return {integer<Tag>(integer_type(r.value_ - rhs.value_)), false};
-                }
-                else
-                {
-                    return {integer<Tag>(integer_type(r.value_ + rhs.value_)), false};
-                }
-            }
-            else
-            {
-                return {r, false};
-            }
+            // r + |rhs| if r is negative, |rhs| does not fit in integer_type for MIN
+            const auto sign = unsigned_type(sign_mask(divisor));
+            const auto abs = unsigned_type(unsigned_type(unsigned_type(divisor) ^ sign) - sign);
+            const auto adjust = unsigned_type(unsigned_type(sign_mask(r)) & abs);
+            return {integer<Tag>(integer_type(unsigned_type(unsigned_type(r) + adjust))),
+                    overflow};
         }
         else
         {
-            return {this->rem(rhs), false};
+            return {integer<Tag>(r), overflow};
         }
     }
 
@@ -1829,7 +1920,7 @@ template<typename Tag> class integer final
 
         auto value = integer<Tag>::unchecked_create(1);
         bool overflow = false;
-        for (const auto _ : std::views::iota(0ul, exp.value_))
+        for (const auto _ : std::views::iota(0u, exp.value_))
         {
             auto [res_value, res_overflow] = this->overflowing_mul(value);
             value = res_value;
@@ -2756,6 +2847,44 @@ template<typename Tag> class integer final
         shl,
     };
 
+    /**
+     * @return the divisor to use for self / rhs, and if self / rhs overflows.
+     * MIN / -1 divides by 1 instead, so the division itself can not trap.
+     */
+    [[nodiscard]] constexpr std::tuple<integer_type, bool>
+    overflowing_divisor(const integer<Tag> rhs) const noexcept
+    {
+        if constexpr (detail::is_signed_integer<integer_type>)
+        {
+            const bool overflow =
+                this->value_ == std::numeric_limits<integer_type>::min() && rhs.value_ == -1;
+            return {overflow ? integer_type(1) : rhs.value_, overflow};
+        }
+        else
+        {
+            return {rhs.value_, false};
+        }
+    }
+
+    /**
+     * @return all bits set if v is negative, otherwise 0
+     */
+    [[nodiscard]] static constexpr integer_type
+    sign_mask(const integer_type v) noexcept
+        requires(detail::is_signed_integer<integer_type>)
+    {
+        return integer_type(v >> std::numeric_limits<integer_type>::digits);
+    }
+
+    /**
+     * @return all bits set if v is not zero, otherwise 0
+     */
+    [[nodiscard]] static constexpr integer_type
+    nonzero_mask(const integer_type v) noexcept
+    {
+        return integer_type(-integer_type(v != 0));
+    }
+
     static constexpr void
     panic_if(const bool cond, const panic_type t) noexcept
     {
@@ -2790,6 +2919,8 @@ template<typename Tag> class integer final
         std::unreachable();
     }
 
+    // This must remain the only data member, integer<Tag> is required to be
+    // layout compatible with integer_type. See ztd::as_integers().
     integer_type value_{0};
 };
 
@@ -0,0 +1,191 @@
+/**
+ * Copyright (C) 2025 Brandon Zorn <brandonzorn@cock.li>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <charconv>
+#include <expected>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+#include "../charconv.hxx"
+#include "integer.hxx"
+
+namespace ztd
+{
+/**
+ * @brief to_chars
+ *
+ *  - Write the value of an integer into [first, last), with the same
+ *    contract as std::to_chars. Only base 10 and base 16 are supported.
+ *
+ * @param[in] first The start of the output buffer
+ * @param[in] last The end of the output buffer
+ * @param[in] value The integer to write
+ * @param[in] base The base to write in
+ *
+ * @return std::to_chars_result
+ */
+template<typename Tag>
+[[nodiscard]] constexpr std::to_chars_result
+to_chars(char* first, char* last, const integer<Tag> value, const int base = 10) noexcept
+{
+    return detail::charconv::to_chars(first, last, value.data(), base);
+}
+
+/**
+ * @brief from_chars
+ *
+ *  - Read an integer from [first, last), with the same contract as
+ *    std::from_chars. Only base 10 and base 16 are supported.
+ *
+ * @param[in] first The start of the input
+ * @param[in] last The end of the input
+ * @param[out] value The parsed integer, unchanged on error
+ * @param[in] base The base to read in
+ *
+ * @return std::from_chars_result
+ */
+template<typename Tag>
+[[nodiscard]] constexpr std::from_chars_result
+from_chars(const char* first, const char* last, integer<Tag>& value, const int base = 10) noexcept
+{
+    typename integer<Tag>::integer_type result{};
+    const auto r = detail::charconv::from_chars(first, last, result, base);
+    if (r.ec == std::errc())
+    {
+        value = integer<Tag>(result);
+    }
+    return r;
+}
+
+/**
+ * @brief parse_column
+ *
+ *  - Parse a column of delimited integers, i.e. one integer per line.
+ *    A single trailing delimiter is allowed.
+ *
+ * @param[in] str The delimited integers
+ * @param[in] delimiter The character between each integer
+ * @param[in] base The base to read in
+ *
+ * @return The parsed integers, or the index of the first field that is
+ *         not a valid integer
+ */
+template<typename Integer>
+[[nodiscard]] inline std::expected<std::vector<Integer>, std::size_t>
+parse_column(const std::string_view str, const char delimiter = '\n', const int base = 10)
+{
+    std::vector<Integer> result;
+    if (str.empty())
+    {
+        return result;
+    }
+    // a decent lower bound, two chars per field
+    result.reserve(str.size() / 2);
+
+    const char* ptr = str.data();
+    const char* const last = str.data() + str.size();
+    while (true)
+    {
+        typename Integer::integer_type value{};
+        const auto [end, ec] = detail::charconv::from_chars(ptr, last, value, base);
+        if (ec != std::errc() || (end != last && *end != delimiter))
+        {
+            return std::unexpected(result.size());
+        }
+        result.push_back(Integer(value));
+
+        if (end == last || end + 1 == last)
+        {
+            break;
+        }
+        ptr = end + 1;
+    }
+    return result;
+}
+
+/**
+ * @brief format_column
+ *
+ *  - Format integers as a delimited column, i.e. one integer per line.
+ *    There is no trailing delimiter.
+ *
+ * @param[in] values The integers to format
+ * @param[in] delimiter The character between each integer
+ * @param[in] base The base to write in
+ *
+ * @return The formatted integers, or std::errc::invalid_argument if the
+ *         base is not supported
+ */
+template<typename Tag>
+[[nodiscard]] inline std::expected<std::string, std::errc>
+format_column(const std::span<const integer<Tag>> values,
+              const char delimiter = '\n',
+              const int base = 10)
+{
+    // checked once here, so that every field fits its max_field below
+    if (base != 10 && base != 16)
+    {
+        return std::unexpected(std::errc::invalid_argument);
+    }
+
+    // sign, 20 digits for std::uint64_t, and the delimiter
+    constexpr std::size_t max_field = 22;
+
+    std::string result;
+    result.resize_and_overwrite(
+        values.size() * max_field,
+        [&](char* buffer, const std::size_t size)
+        {
+            char* ptr = buffer;
+            char* const last = buffer + size;
+            for (const auto value : values)
+            {
+                ptr = detail::charconv::to_chars(ptr, last, value.data(), base).ptr;
+                *ptr++ = delimiter;
+            }
+            return values.empty() ? 0 : static_cast<std::size_t>(ptr - buffer) - 1;
+        });
+    return result;
+}
+
+/**
+ * @brief format_column
+ *
+ *  - Format integers as a delimited column, i.e. one integer per line.
+ *    There is no trailing delimiter.
+ *
+ * @param[in] values The integers to format
+ * @param[in] delimiter The character between each integer
+ * @param[in] base The base to write in
+ *
+ * @return The formatted integers, or std::errc::invalid_argument if the
+ *         base is not supported
+ */
+template<typename Tag>
+[[nodiscard]] inline std::expected<std::string, std::errc>
+format_column(const std::span<integer<Tag>> values,
+              const char delimiter = '\n',
+              const int base = 10)
+{
+    return format_column(std::span<const integer<Tag>>(values), delimiter, base);
+}
+} // namespace ztd
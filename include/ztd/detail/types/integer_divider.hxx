@@ -0,0 +1,393 @@
+/**
+ * Copyright (C) 2025 Brandon Zorn <brandonzorn@cock.li>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+
+#include <cstdint>
+
+#include "../concepts.hxx"
+#include "../panic.hxx"
+#include "integer.hxx"
+#include "integer_type.hxx"
+
+// Division by a runtime invariant divisor using a precomputed multiplier,
+// see T. Granlund and P. L. Montgomery, "Division by Invariant Integers using
+// Multiplication" (1994). Figure 4.1 for unsigned and figure 5.2 for signed
+// division. A divide becomes a multiply high, an add, and shifts.
+
+namespace ztd
+{
+namespace detail::divide
+{
+// clang-format off
+__extension__ using uint128 = unsigned __int128;
+__extension__ using int128 = __int128;
+
+template<typename T> struct wide;
+template<> struct wide<std::uint8_t>  { using type = std::uint32_t; };
+template<> struct wide<std::uint16_t> { using type = std::uint32_t; };
+template<> struct wide<std::uint32_t> { using type = std::uint64_t; };
+template<> struct wide<std::uint64_t> { using type = uint128; };
+template<> struct wide<std::int8_t>   { using type = std::int32_t; };
+template<> struct wide<std::int16_t>  { using type = std::int32_t; };
+template<> struct wide<std::int32_t>  { using type = std::int64_t; };
+template<> struct wide<std::int64_t>  { using type = int128; };
+// clang-format on
+
+template<typename T> using wide_t = typename wide<T>::type;
+
+/**
+ * @return the high half of the full width product lhs * rhs
+ */
+template<typename T>
+[[nodiscard]] constexpr T
+mul_high(const T lhs, const T rhs) noexcept
+{
+    constexpr auto bits = std::numeric_limits<std::make_unsigned_t<T>>::digits;
+    return T((wide_t<T>(lhs) * wide_t<T>(rhs)) >> bits);
+}
+} // namespace detail::divide
+
+template<typename Integer> class divider final
+{
+  public:
+    using value_type = Integer;
+    using integer_type = typename Integer::integer_type;
+
+    /**
+     * @brief divider - precompute the multiplier for dividing by d
+     *
+     * @param[in] d The divisor, must not be zero
+     */
+    constexpr explicit divider(const Integer d) noexcept : divisor_(d.data())
+    {
+        ztd::panic_if(d == 0, "attempt to divide by zero");
+
+        using wide_type = detail::divide::wide_t<unsigned_type>;
+        constexpr auto bits = std::numeric_limits<unsigned_type>::digits;
+
+        if constexpr (detail::is_unsigned_integer<integer_type>)
+        {
+            // l = ceil(log2(d))
+            const auto l = int(std::bit_width(unsigned_type(this->divisor_ - 1)));
+            // m = floor(2^N * (2^l - d) / d) + 1
+            const auto m =
+                (((wide_type(1) << l) - this->divisor_) << bits) / this->divisor_ + 1;
+            this->magic_ = unsigned_type(m);
+            this->shift1_ = std::uint8_t(std::min(l, 1));
+            this->shift2_ = std::uint8_t(std::max(l - 1, 0));
+        }
+        else
+        {
+            const auto abs = this->unsigned_abs(this->divisor_);
+            // l = max(ceil(log2(|d|)), 1)
+            const auto l = std::max(int(std::bit_width(unsigned_type(abs - 1))), 1);
+            // m = 1 + floor(2^(N + l - 1) / |d|), stored as m - 2^N
+            const auto m = (wide_type(1) << (bits + l - 1)) / abs + 1;
+            this->magic_ = unsigned_type(m);
+            this->shift1_ = std::uint8_t(l - 1);
+        }
+    }
+
+    /**
+     * @return the divisor
+     */
+    [[nodiscard]] constexpr Integer
+    divisor() const noexcept
+    {
+        return Integer(this->divisor_);
+    }
+
+    /**
+     * @brief overflowing_div - Wrapping (modular) division
+     * @return n / divisor, If an overflow would occur then MIN is returned.
+     */
+    [[nodiscard]] constexpr std::tuple<Integer, bool>
+    overflowing_div(const Integer n) const noexcept
+    {
+        return {Integer(this->quotient(n.data())), this->overflows(n.data())};
+    }
+
+    /**
+     * @brief overflowing_rem - Wrapping (modular) remainder
+     * @return n % divisor, If an overflow would occur then 0 is returned.
+     */
+    [[nodiscard]] constexpr std::tuple<Integer, bool>
+    overflowing_rem(const Integer n) const noexcept
+    {
+        const auto q = this->quotient(n.data());
+        return {Integer(this->remainder(n.data(), q)), this->overflows(n.data())};
+    }
+
+    /**
+     * @brief overflowing_div_floor - Wrapping (modular) division
+     * @return n / divisor, rounded towards negative infinity. If an overflow would
+     * occur then MIN is returned.
+     */
+    [[nodiscard]] constexpr std::tuple<Integer, bool>
+    overflowing_div_floor(const Integer n) const noexcept
+    {
+        const auto q = this->quotient(n.data());
+        if constexpr (detail::is_signed_integer<integer_type>)
+        {
+            const auto r = this->remainder(n.data(), q);
+            // -1 if there is a remainder and the quotient is negative
+            const auto adjust =
+                integer_type(nonzero_mask(r) & sign_mask(integer_type(r ^ this->divisor_)));
+            return {Integer(integer_type(q + adjust)), this->overflows(n.data())};
+        }
+        else
+        {
+            return {Integer(q), false};
+        }
+    }
+
+    /**
+     * @brief overflowing_div_ceil - Wrapping (modular) division
+     * @return n / divisor, rounded towards positive infinity. If an overflow would
+     * occur then MIN is returned.
+     */
+    [[nodiscard]] constexpr std::tuple<Integer, bool>
+    overflowing_div_ceil(const Integer n) const noexcept
+    {
+        const auto q = this->quotient(n.data());
+        const auto r = this->remainder(n.data(), q);
+        if constexpr (detail::is_signed_integer<integer_type>)
+        {
+            // 1 if there is a remainder and the quotient is positive
+            const auto adjust =
+                integer_type(nonzero_mask(r) & ~sign_mask(integer_type(r ^ this->divisor_)) & 1);
+            return {Integer(integer_type(q + adjust)), this->overflows(n.data())};
+        }
+        else
+        {
+            return {Integer(integer_type(q + (r != 0))), false};
+        }
+    }
+
+    /**
+     * @brief overflowing_div_euclid - Wrapping euclidean division
+     * @return n / divisor, such that the remainder is never negative. If an
+     * overflow would occur then MIN is returned.
+     */
+    [[nodiscard]] constexpr std::tuple<Integer, bool>
+    overflowing_div_euclid(const Integer n) const noexcept
+    {
+        const auto q = this->quotient(n.data());
+        if constexpr (detail::is_signed_integer<integer_type>)
+        {
+            const auto r = this->remainder(n.data(), q);
+            // a negative remainder moves the quotient one step away from the sign of divisor
+            const auto adjust = integer_type(sign_mask(r) & (sign_mask(this->divisor_) | 1));
+            return {Integer(integer_type(q - adjust)), this->overflows(n.data())};
+        }
+        else
+        {
+            return {Integer(q), false};
+        }
+    }
+
+    /**
+     * @brief overflowing_rem_euclid - Wrapping euclidean remainder
+     * @return n % divisor, never negative. If an overflow would occur then 0 is returned.
+     */
+    [[nodiscard]] constexpr std::tuple<Integer, bool>
+    overflowing_rem_euclid(const Integer n) const noexcept
+    {
+        const auto q = this->quotient(n.data());
+        const auto r = this->remainder(n.data(), q);
+        if constexpr (detail::is_signed_integer<integer_type>)
+        {
+            const auto abs = this->unsigned_abs(this->divisor_);
+            const auto adjust = unsigned_type(unsigned_type(sign_mask(r)) & abs);
+            return {Integer(integer_type(unsigned_type(unsigned_type(r) + adjust))),
+                    this->overflows(n.data())};
+        }
+        else
+        {
+            return {Integer(r), false};
+        }
+    }
+
+    /**
+     * @brief div - integer division
+     * @return n / divisor, side effects determined by default math mode.
+     */
+    [[nodiscard]] constexpr Integer
+    div(const Integer n) const noexcept
+    {
+        return this->apply(this->overflowing_div(n), "attempt to divide with overflow");
+    }
+
+    /**
+     * @brief rem - integer remainder
+     * @return n % divisor, side effects determined by default math mode.
+     */
+    [[nodiscard]] constexpr Integer
+    rem(const Integer n) const noexcept
+    {
+        return this->apply(this->overflowing_rem(n),
+                           "attempt to calculate the remainder with overflow");
+    }
+
+    /**
+     * @brief div_floor - integer division
+     * @return n / divisor, rounded towards negative infinity. side effects
+     * determined by default math mode.
+     */
+    [[nodiscard]] constexpr Integer
+    div_floor(const Integer n) const noexcept
+    {
+        return this->apply(this->overflowing_div_floor(n), "attempt to divide with overflow");
+    }
+
+    /**
+     * @brief div_ceil - integer division
+     * @return n / divisor, rounded towards positive infinity. side effects
+     * determined by default math mode.
+     */
+    [[nodiscard]] constexpr Integer
+    div_ceil(const Integer n) const noexcept
+    {
+        return this->apply(this->overflowing_div_ceil(n), "attempt to divide with overflow");
+    }
+
+    /**
+     * @brief div_euclid - euclidean division
+     * @return n / divisor, side effects determined by default math mode.
+     */
+    [[nodiscard]] constexpr Integer
+    div_euclid(const Integer n) const noexcept
+    {
+        return this->apply(this->overflowing_div_euclid(n), "attempt to divide with overflow");
+    }
+
+    /**
+     * @brief rem_euclid - euclidean remainder
+     * @return n % divisor, side effects determined by default math mode.
+     */
+    [[nodiscard]] constexpr Integer
+    rem_euclid(const Integer n) const noexcept
+    {
+        return this->apply(this->overflowing_rem_euclid(n),
+                           "attempt to calculate the remainder with overflow");
+    }
+
+  private:
+    using unsigned_type = std::make_unsigned_t<integer_type>;
+
+    /**
+     * @return n / divisor, rounded towards zero, wrapping on overflow
+     */
+    [[nodiscard]] constexpr integer_type
+    quotient(const integer_type n) const noexcept
+    {
+        if constexpr (detail::is_unsigned_integer<integer_type>)
+        {
+            const auto t = detail::divide::mul_high(this->magic_, n);
+            const auto u = unsigned_type(unsigned_type(n - t) >> this->shift1_);
+            return integer_type(unsigned_type(t + u) >> this->shift2_);
+        }
+        else
+        {
+            // all arithmetic is modulo 2^N, done in unsigned_type
+            const auto high = detail::divide::mul_high(integer_type(this->magic_), n);
+            const auto q = integer_type(unsigned_type(unsigned_type(n) + unsigned_type(high)));
+            const auto q0 = unsigned_type(unsigned_type(integer_type(q >> this->shift1_)) -
+                                          unsigned_type(sign_mask(n)));
+            const auto sign = unsigned_type(sign_mask(this->divisor_));
+            return integer_type(unsigned_type(unsigned_type(q0 ^ sign) - sign));
+        }
+    }
+
+    /**
+     * @return n - q * divisor, wrapping on overflow
+     */
+    [[nodiscard]] constexpr integer_type
+    remainder(const integer_type n, const integer_type q) const noexcept
+    {
+        return integer_type(
+            unsigned_type(unsigned_type(n) - unsigned_type(unsigned_type(q) *
+                                                           unsigned_type(this->divisor_))));
+    }
+
+    /**
+     * @return true if n / divisor overflows, MIN / -1
+     */
+    [[nodiscard]] constexpr bool
+    overflows(const integer_type n) const noexcept
+    {
+        if constexpr (detail::is_signed_integer<integer_type>)
+        {
+            return this->divisor_ == -1 && n == std::numeric_limits<integer_type>::min();
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    [[nodiscard]] static constexpr Integer
+    apply(const std::tuple<Integer, bool> result, const char* message) noexcept
+    {
+        const auto [value, overflow] = result;
+        if constexpr (std::same_as<detail::default_math, detail::math_strict>)
+        {
+            ztd::panic_if(overflow, "{}", message);
+        }
+        return value;
+    }
+
+    [[nodiscard]] static constexpr unsigned_type
+    unsigned_abs(const integer_type v) noexcept
+    {
+        const auto sign = unsigned_type(sign_mask(v));
+        return unsigned_type(unsigned_type(unsigned_type(v) ^ sign) - sign);
+    }
+
+    [[nodiscard]] static constexpr integer_type
+    sign_mask(const integer_type v) noexcept
+    {
+        if constexpr (detail::is_signed_integer<integer_type>)
+        {
+            return integer_type(v >> std::numeric_limits<integer_type>::digits);
+        }
+        else
+        {
+            return 0;
+        }
+    }
+
+    [[nodiscard]] static constexpr integer_type
+    nonzero_mask(const integer_type v) noexcept
+    {
+        return integer_type(-integer_type(v != 0));
+    }
+
+    integer_type divisor_;
+    unsigned_type magic_{0};
+    std::uint8_t shift1_{0};
+    std::uint8_t shift2_{0};
+};
+} // namespace ztd
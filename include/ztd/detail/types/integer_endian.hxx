@@ -0,0 +1,169 @@
+/**
+ * Copyright (C) 2025 Brandon Zorn <brandonzorn@cock.li>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <bit>
+#include <compare>
+#include <format>
+#include <functional>
+#include <type_traits>
+
+#if defined(ZTD_TEST_SUITE)
+#include <ostream>
+#endif
+
+#include "integer.hxx"
+
+// ztd::integer stored in a fixed byte order, for fields in wire formats and
+// file headers.
+//
+//   ztd::be<ztd::u32> - stored big endian (network order)
+//   ztd::le<ztd::u64> - stored little endian
+//
+// The layout is the same as the raw integer, so a struct of these can be
+// overlaid onto a received or mmapped buffer. The byte order is converted
+// only when the value is loaded or stored.
+
+namespace ztd
+{
+template<typename Integer, std::endian Order> class endian_integer final
+{
+  public:
+    using value_type = Integer;
+    using integer_type = typename Integer::integer_type;
+    static constexpr std::endian order = Order;
+    static_assert(Order == std::endian::big || Order == std::endian::little);
+    static_assert(std::endian::native == std::endian::big ||
+                  std::endian::native == std::endian::little);
+
+    constexpr endian_integer() noexcept = default;
+
+    constexpr endian_integer(const Integer rhs) noexcept : value_(convert(rhs.data())) {}
+
+    /**
+     * @brief from_raw
+     *
+     *  - Create from the stored representation, already in Order.
+     */
+    [[nodiscard]] static constexpr endian_integer
+    from_raw(const integer_type raw) noexcept
+    {
+        endian_integer result;
+        result.value_ = raw;
+        return result;
+    }
+
+    /**
+     * @return the value in native byte order
+     */
+    [[nodiscard]] constexpr Integer
+    value() const noexcept
+    {
+        return Integer(convert(this->value_));
+    }
+
+    /**
+     * @return the value in native byte order as the underlying integer_type
+     */
+    [[nodiscard]] constexpr integer_type
+    data() const noexcept
+    {
+        return convert(this->value_);
+    }
+
+    /**
+     * @return the stored representation, in Order
+     */
+    [[nodiscard]] constexpr integer_type
+    raw() const noexcept
+    {
+        return this->value_;
+    }
+
+    constexpr
+    operator Integer() const noexcept
+    {
+        return this->value();
+    }
+
+    // comparison operators
+
+    [[nodiscard]] friend constexpr bool
+    operator==(const endian_integer lhs, const endian_integer rhs) noexcept
+    {
+        // same byte order on both sides, no need to convert
+        return lhs.value_ == rhs.value_;
+    }
+
+    [[nodiscard]] friend constexpr std::strong_ordering
+    operator<=>(const endian_integer lhs, const endian_integer rhs) noexcept
+    {
+        return lhs.data() <=> rhs.data();
+    }
+
+#if defined(ZTD_TEST_SUITE)
+    // needed for doctest to show values
+    friend std::ostream&
+    operator<<(std::ostream& os, const endian_integer obj)
+    {
+        os << obj.value();
+        return os;
+    }
+#endif
+
+  private:
+    [[nodiscard]] static constexpr integer_type
+    convert(const integer_type value) noexcept
+    {
+        if constexpr (Order == std::endian::native)
+        {
+            return value;
+        }
+        else
+        {
+            return std::byteswap(value);
+        }
+    }
+
+    integer_type value_ = 0;
+};
+
+template<typename Integer> using be = endian_integer<Integer, std::endian::big>;
+template<typename Integer> using le = endian_integer<Integer, std::endian::little>;
+} // namespace ztd
+
+// std::format
+template<typename Integer, std::endian Order>
+struct std::formatter<ztd::endian_integer<Integer, Order>> : std::formatter<Integer>
+{
+    auto
+    format(const ztd::endian_integer<Integer, Order>& obj, std::format_context& ctx) const
+    {
+        return std::formatter<Integer>::format(obj.value(), ctx);
+    }
+};
+
+// std::hash
+template<typename Integer, std::endian Order> struct std::hash<ztd::endian_integer<Integer, Order>>
+{
+    typename Integer::integer_type
+    operator()(const ztd::endian_integer<Integer, Order>& obj) const
+    {
+        return std::hash<Integer>()(obj.value());
+    }
+};
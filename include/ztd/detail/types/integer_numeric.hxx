@@ -0,0 +1,539 @@
+/**
+ * Copyright (C) 2025 Brandon Zorn <brandonzorn@cock.li>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <future>
+#include <limits>
+#include <optional>
+#include <span>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <cstdint>
+
+#include "../concepts.hxx"
+#include "integer.hxx"
+#include "integer_span.hxx"
+
+// Reductions over std::span<ztd::integer<Tag>>.
+//
+// Sums are accumulated exactly in 128-bit and only checked against the range
+// of the type once, at the end. The inner loops only use plain integer adds
+// in lanes that can not overflow within a block, so the compiler can
+// auto-vectorize them:
+//  - 8, 16 and 32-bit values are summed in 64-bit lanes.
+//  - 64-bit values are split into their high and low 32-bit halves, which
+//    are summed separately in 64-bit lanes (a carry-save sum).
+
+namespace ztd
+{
+namespace detail::numeric
+{
+__extension__ using int128 = __int128;
+
+// number of elements summed in 64-bit lanes before folding into the 128-bit
+// total, small enough that a lane can never overflow.
+inline constexpr std::size_t block_size = std::size_t(1) << 16;
+
+// smallest number of elements worth handing to another thread.
+inline constexpr std::size_t parallel_min_size = std::size_t(1) << 18;
+
+/**
+ * @return the exact sum of values
+ */
+template<typename T>
+[[nodiscard]] constexpr int128
+sum(const std::span<const T> values) noexcept
+{
+    int128 total = 0;
+    for (std::size_t base = 0; base < values.size(); base += block_size)
+    {
+        const auto block = values.subspan(base, std::min(block_size, values.size() - base));
+
+        if constexpr (sizeof(T) < sizeof(std::int64_t))
+        {
+            using lane = std::conditional_t<is_signed_integer<T>, std::int64_t, std::uint64_t>;
+
+            lane s = 0;
+            for (const auto v : block)
+            {
+                s += lane(v);
+            }
+            total += int128(s);
+        }
+        else
+        {
+            using high_lane = std::conditional_t<is_signed_integer<T>, std::int64_t, std::uint64_t>;
+
+            // v = high * 2^32 + low, with low always unsigned.
+            high_lane high = 0;
+            std::uint64_t low = 0;
+            for (const auto v : block)
+            {
+                high += high_lane(v >> 32);
+                low += std::uint64_t(v) & 0xffff'ffff;
+            }
+            total += int128(high) * (int128(1) << 32) + int128(low);
+        }
+    }
+    return total;
+}
+
+/**
+ * @brief the product of values as its magnitude and sign. The magnitude of a
+ * non zero value is at least 1, so the magnitude of the product never shrinks,
+ * once it does not fit in the unsigned type the product does not fit in T.
+ */
+template<typename T> struct product_result
+{
+    using magnitude_type = std::make_unsigned_t<T>;
+
+    magnitude_type magnitude = 1;
+    bool negative = false;
+    bool overflow = false;
+    bool zero = false;
+
+    constexpr void
+    multiply(const product_result& rhs) noexcept
+    {
+        this->zero |= rhs.zero;
+        this->overflow |= rhs.overflow;
+        this->overflow |= __builtin_mul_overflow(this->magnitude, rhs.magnitude, &this->magnitude);
+        this->negative ^= rhs.negative;
+    }
+
+    /**
+     * @return the product, or std::nullopt if it does not fit in T
+     */
+    [[nodiscard]] constexpr std::optional<T>
+    value() const noexcept
+    {
+        if (this->zero)
+        {
+            return T(0);
+        }
+
+        constexpr auto max = magnitude_type(std::numeric_limits<T>::max());
+        // -MIN is one more than MAX
+        const auto limit = this->negative ? magnitude_type(max + 1) : max;
+        if (this->overflow || this->magnitude > limit)
+        {
+            return std::nullopt;
+        }
+        return this->negative ? T(magnitude_type(0) - this->magnitude) : T(this->magnitude);
+    }
+};
+
+/**
+ * @return the exact product of values
+ */
+template<typename T>
+[[nodiscard]] constexpr product_result<T>
+product(const std::span<const T> values) noexcept
+{
+    using magnitude_type = typename product_result<T>::magnitude_type;
+
+    product_result<T> p;
+    for (const auto v : values)
+    {
+        bool negative = false;
+        if constexpr (is_signed_integer<T>)
+        {
+            negative = v < 0;
+        }
+        const auto magnitude = negative ? magnitude_type(magnitude_type(0) - magnitude_type(v))
+                                        : magnitude_type(v);
+        p.overflow |= __builtin_mul_overflow(p.magnitude, magnitude, &p.magnitude);
+        p.negative ^= negative;
+        p.zero |= v == 0;
+    }
+    return p;
+}
+
+/**
+ * @return the value if it is in range of T, otherwise std::nullopt
+ */
+template<typename T>
+[[nodiscard]] constexpr std::optional<T>
+narrow(const int128 v) noexcept
+{
+    if (v < int128(std::numeric_limits<T>::min()) || v > int128(std::numeric_limits<T>::max()))
+    {
+        return std::nullopt;
+    }
+    return T(v);
+}
+
+/**
+ * @return v clamped to the range of T
+ */
+template<typename T>
+[[nodiscard]] constexpr T
+clamp(const int128 v) noexcept
+{
+    return T(std::clamp(v,
+                        int128(std::numeric_limits<T>::min()),
+                        int128(std::numeric_limits<T>::max())));
+}
+
+/**
+ * @brief split values into chunks, run op over each chunk on its own thread,
+ * and return the results in order.
+ */
+template<typename T, typename Op>
+[[nodiscard]] auto
+parallel_map(const std::span<const T> values, std::size_t threads, const Op op)
+{
+    using result_type = std::invoke_result_t<Op, std::span<const T>>;
+
+    if (threads == 0)
+    {
+        threads = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+    threads = std::clamp(values.size() / parallel_min_size, std::size_t(1), threads);
+
+    const auto chunk = values.size() / threads;
+
+    // the calling thread takes the first chunk.
+    std::vector<std::future<result_type>> futures;
+    futures.reserve(threads - 1);
+    for (std::size_t i = 1; i < threads; ++i)
+    {
+        const auto count = i == threads - 1 ? values.size() - i * chunk : chunk;
+        futures.push_back(
+            std::async(std::launch::async, op, values.subspan(i * chunk, count)));
+    }
+
+    std::vector<result_type> results;
+    results.reserve(threads);
+    results.push_back(op(values.subspan(0, threads == 1 ? values.size() : chunk)));
+    for (auto& f : futures)
+    {
+        results.push_back(f.get());
+    }
+    return results;
+}
+
+template<typename T>
+[[nodiscard]] int128
+parallel_sum(const std::span<const T> values, const std::size_t threads)
+{
+    int128 total = 0;
+    for (const auto s : parallel_map(values, threads, [](const auto c) { return sum(c); }))
+    {
+        total += s;
+    }
+    return total;
+}
+} // namespace detail::numeric
+
+/**
+ * @brief checked_sum - Checked sum of all values
+ *
+ * @param[in] values The values to add up
+ *
+ * @return the sum of values, or std::nullopt if the sum does not fit in the type.
+ * Only the final sum is checked, an intermediate sum may go out of range.
+ */
+template<typename Tag>
+[[nodiscard]] constexpr std::optional<integer<Tag>>
+checked_sum(const std::span<const integer<Tag>> values) noexcept
+{
+    using integer_type = typename integer<Tag>::integer_type;
+
+    const auto sum = detail::numeric::narrow<integer_type>(
+        detail::numeric::sum(as_raw(values)));
+    return sum ? std::optional(integer<Tag>(*sum)) : std::nullopt;
+}
+
+/**
+ * @brief checked_sum - Checked sum of all values
+ *
+ * @param[in] values The values to add up
+ *
+ * @return the sum of values, or std::nullopt if the sum does not fit in the type.
+ * Only the final sum is checked, an intermediate sum may go out of range.
+ */
+template<typename Tag>
+[[nodiscard]] constexpr std::optional<integer<Tag>>
+checked_sum(const std::span<integer<Tag>> values) noexcept
+{
+    return checked_sum(std::span<const integer<Tag>>(values));
+}
+
+/**
+ * @brief saturating_sum - Saturating sum of all values
+ *
+ * @param[in] values The values to add up
+ *
+ * @return the sum of values, clamped to the range of the type.
+ */
+template<typename Tag>
+[[nodiscard]] constexpr integer<Tag>
+saturating_sum(const std::span<const integer<Tag>> values) noexcept
+{
+    using integer_type = typename integer<Tag>::integer_type;
+
+    return integer<Tag>(
+        detail::numeric::clamp<integer_type>(detail::numeric::sum(as_raw(values))));
+}
+
+/**
+ * @brief saturating_sum - Saturating sum of all values
+ *
+ * @param[in] values The values to add up
+ *
+ * @return the sum of values, clamped to the range of the type.
+ */
+template<typename Tag>
+[[nodiscard]] constexpr integer<Tag>
+saturating_sum(const std::span<integer<Tag>> values) noexcept
+{
+    return saturating_sum(std::span<const integer<Tag>>(values));
+}
+
+/**
+ * @brief checked_product - Checked product of all values
+ *
+ * @param[in] values The values to multiply
+ *
+ * @return the product of values, or std::nullopt if the product does not fit in the type.
+ * Only the final product is checked, an intermediate product may go out of range.
+ * The product of an empty span is 1.
+ */
+template<typename Tag>
+[[nodiscard]] constexpr std::optional<integer<Tag>>
+checked_product(const std::span<const integer<Tag>> values) noexcept
+{
+    const auto product = detail::numeric::product(as_raw(values)).value();
+    return product ? std::optional(integer<Tag>(*product)) : std::nullopt;
+}
+
+/**
+ * @brief checked_product - Checked product of all values
+ *
+ * @param[in] values The values to multiply
+ *
+ * @return the product of values, or std::nullopt if the product does not fit in the type.
+ * Only the final product is checked, an intermediate product may go out of range.
+ * The product of an empty span is 1.
+ */
+template<typename Tag>
+[[nodiscard]] constexpr std::optional<integer<Tag>>
+checked_product(const std::span<integer<Tag>> values) noexcept
+{
+    return checked_product(std::span<const integer<Tag>>(values));
+}
+
+/**
+ * @brief checked_mean - Checked arithmetic mean of all values
+ *
+ * @param[in] values The values to average
+ *
+ * @return the mean of values rounded towards zero, or std::nullopt if values is empty.
+ * The sum is exact and the mean is always in range, so an empty span is the only failure.
+ */
+template<typename Tag>
+[[nodiscard]] constexpr std::optional<integer<Tag>>
+checked_mean(const std::span<const integer<Tag>> values) noexcept
+{
+    using integer_type = typename integer<Tag>::integer_type;
+
+    if (values.empty())
+    {
+        return std::nullopt;
+    }
+    const auto sum = detail::numeric::sum(as_raw(values));
+    return integer<Tag>(integer_type(sum / detail::numeric::int128(values.size())));
+}
+
+/**
+ * @brief checked_mean - Checked arithmetic mean of all values
+ *
+ * @param[in] values The values to average
+ *
+ * @return the mean of values rounded towards zero, or std::nullopt if values is empty.
+ * The sum is exact and the mean is always in range, so an empty span is the only failure.
+ */
+template<typename Tag>
+[[nodiscard]] constexpr std::optional<integer<Tag>>
+checked_mean(const std::span<integer<Tag>> values) noexcept
+{
+    return checked_mean(std::span<const integer<Tag>>(values));
+}
+
+/**
+ * @brief parallel_checked_sum - checked_sum() split across threads
+ *
+ * @param[in] values The values to add up
+ * @param[in] threads The maximum number of threads to use, 0 for one per core.
+ * Small inputs use fewer threads.
+ *
+ * @return the sum of values, or std::nullopt if the sum does not fit in the type.
+ */
+template<typename Tag>
+[[nodiscard]] inline std::optional<integer<Tag>>
+parallel_checked_sum(const std::span<const integer<Tag>> values, const std::size_t threads = 0)
+{
+    using integer_type = typename integer<Tag>::integer_type;
+
+    const auto sum = detail::numeric::narrow<integer_type>(
+        detail::numeric::parallel_sum(as_raw(values), threads));
+    return sum ? std::optional(integer<Tag>(*sum)) : std::nullopt;
+}
+
+/**
+ * @brief parallel_checked_sum - checked_sum() split across threads
+ *
+ * @param[in] values The values to add up
+ * @param[in] threads The maximum number of threads to use, 0 for one per core.
+ * Small inputs use fewer threads.
+ *
+ * @return the sum of values, or std::nullopt if the sum does not fit in the type.
+ */
+template<typename Tag>
+[[nodiscard]] inline std::optional<integer<Tag>>
+parallel_checked_sum(const std::span<integer<Tag>> values, const std::size_t threads = 0)
+{
+    return parallel_checked_sum(std::span<const integer<Tag>>(values), threads);
+}
+
+/**
+ * @brief parallel_saturating_sum - saturating_sum() split across threads
+ *
+ * @param[in] values The values to add up
+ * @param[in] threads The maximum number of threads to use, 0 for one per core.
+ * Small inputs use fewer threads.
+ *
+ * @return the sum of values, clamped to the range of the type.
+ */
+template<typename Tag>
+[[nodiscard]] inline integer<Tag>
+parallel_saturating_sum(const std::span<const integer<Tag>> values,
+                        const std::size_t threads = 0)
+{
+    using integer_type = typename integer<Tag>::integer_type;
+
+    return integer<Tag>(detail::numeric::clamp<integer_type>(
+        detail::numeric::parallel_sum(as_raw(values), threads)));
+}
+
+/**
+ * @brief parallel_saturating_sum - saturating_sum() split across threads
+ *
+ * @param[in] values The values to add up
+ * @param[in] threads The maximum number of threads to use, 0 for one per core.
+ * Small inputs use fewer threads.
+ *
+ * @return the sum of values, clamped to the range of the type.
+ */
+template<typename Tag>
+[[nodiscard]] inline integer<Tag>
+parallel_saturating_sum(const std::span<integer<Tag>> values, const std::size_t threads = 0)
+{
+    return parallel_saturating_sum(std::span<const integer<Tag>>(values), threads);
+}
+
+/**
+ * @brief parallel_checked_product - checked_product() split across threads
+ *
+ * @param[in] values The values to multiply
+ * @param[in] threads The maximum number of threads to use, 0 for one per core.
+ * Small inputs use fewer threads.
+ *
+ * @return the product of values, or std::nullopt if the product does not fit in the type.
+ * Only the final product is checked, an intermediate product may go out of range.
+ */
+template<typename Tag>
+[[nodiscard]] inline std::optional<integer<Tag>>
+parallel_checked_product(const std::span<const integer<Tag>> values,
+                         const std::size_t threads = 0)
+{
+    using integer_type = typename integer<Tag>::integer_type;
+
+    detail::numeric::product_result<integer_type> total;
+    for (const auto& p :
+         detail::numeric::parallel_map(as_raw(values), threads,
+                                       [](const auto c) { return detail::numeric::product(c); }))
+    {
+        total.multiply(p);
+    }
+    const auto product = total.value();
+    return product ? std::optional(integer<Tag>(*product)) : std::nullopt;
+}
+
+/**
+ * @brief parallel_checked_product - checked_product() split across threads
+ *
+ * @param[in] values The values to multiply
+ * @param[in] threads The maximum number of threads to use, 0 for one per core.
+ * Small inputs use fewer threads.
+ *
+ * @return the product of values, or std::nullopt if the product does not fit in the type.
+ * Only the final product is checked, an intermediate product may go out of range.
+ */
+template<typename Tag>
+[[nodiscard]] inline std::optional<integer<Tag>>
+parallel_checked_product(const std::span<integer<Tag>> values, const std::size_t threads = 0)
+{
+    return parallel_checked_product(std::span<const integer<Tag>>(values), threads);
+}
+
+/**
+ * @brief parallel_checked_mean - checked_mean() split across threads
+ *
+ * @param[in] values The values to average
+ * @param[in] threads The maximum number of threads to use, 0 for one per core.
+ * Small inputs use fewer threads.
+ *
+ * @return the mean of values rounded towards zero, or std::nullopt if values is empty.
+ * The sum is exact and the mean is always in range, so an empty span is the only failure.
+ */
+template<typename Tag>
+[[nodiscard]] inline std::optional<integer<Tag>>
+parallel_checked_mean(const std::span<const integer<Tag>> values, const std::size_t threads = 0)
+{
+    using integer_type = typename integer<Tag>::integer_type;
+
+    if (values.empty())
+    {
+        return std::nullopt;
+    }
+    const auto sum = detail::numeric::parallel_sum(as_raw(values), threads);
+    return integer<Tag>(integer_type(sum / detail::numeric::int128(values.size())));
+}
+
+/**
+ * @brief parallel_checked_mean - checked_mean() split across threads
+ *
+ * @param[in] values The values to average
+ * @param[in] threads The maximum number of threads to use, 0 for one per core.
+ * Small inputs use fewer threads.
+ *
+ * @return the mean of values rounded towards zero, or std::nullopt if values is empty.
+ * The sum is exact and the mean is always in range, so an empty span is the only failure.
+ */
+template<typename Tag>
+[[nodiscard]] inline std::optional<integer<Tag>>
+parallel_checked_mean(const std::span<integer<Tag>> values, const std::size_t threads = 0)
+{
+    return parallel_checked_mean(std::span<const integer<Tag>>(values), threads);
+}
+} // namespace ztd
@@ -0,0 +1,434 @@
+/**
+ * Copyright (C) 2025 Brandon Zorn <brandonzorn@cock.li>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "../panic.hxx"
+#include "integer.hxx"
+
+// Compressed storage for integer columns that are mostly monotonic or
+// clustered, i.e. timestamps or inode numbers.
+//
+// Values are stored in blocks of 128. Each block keeps a reference value and
+// the rest as bit-packed offsets, using as many bits as the largest offset
+// in that block needs.
+//
+//   packing::frame_of_reference - offsets from the smallest value in the block
+//   packing::delta              - offsets between consecutive values, minus the
+//                                 smallest such difference in the block
+//
+// The packed words use the interleaved layout of SIMD-BP128, value i is in
+// lane i % lanes, so packing and unpacking a block is a fixed number of
+// identical operations across the lanes that the compiler vectorizes.
+
+namespace ztd
+{
+enum class packing : std::uint8_t
+{
+    frame_of_reference,
+    delta,
+};
+
+namespace detail::packing
+{
+inline constexpr std::size_t block_size = 128;
+
+// 32 bit words for every integer up to 32 bits, so the lanes fit a vector.
+template<typename T>
+using word_t = std::conditional_t<(sizeof(T) <= sizeof(std::uint32_t)), std::uint32_t,
+                                  std::uint64_t>;
+
+template<typename U>
+inline constexpr std::size_t lanes = block_size / std::numeric_limits<U>::digits;
+
+template<typename U>
+[[nodiscard]] constexpr U
+low_mask(const std::size_t width) noexcept
+{
+    return width == std::numeric_limits<U>::digits ? U(~U(0)) : U((U(1) << width) - 1);
+}
+
+// Pack 128 offsets of width bits each into width * lanes words. The buffers
+// can not overlap, which is what lets the lane loops vectorize.
+template<typename U>
+constexpr void
+pack(const U* __restrict const in, const std::size_t width, U* __restrict const out) noexcept
+{
+    constexpr auto bits = std::size_t(std::numeric_limits<U>::digits);
+    constexpr auto L = lanes<U>;
+
+    if (width == 0)
+    {
+        return;
+    }
+
+    std::array<U, L> acc{};
+    std::size_t shift = 0;
+    std::size_t word = 0;
+    for (std::size_t row = 0; row < bits; ++row)
+    {
+        for (std::size_t lane = 0; lane < L; ++lane)
+        {
+            acc[lane] |= U(in[row * L + lane] << shift);
+        }
+
+        shift += width;
+        if (shift >= bits)
+        {
+            shift -= bits;
+            for (std::size_t lane = 0; lane < L; ++lane)
+            {
+                out[word * L + lane] = acc[lane];
+            }
+            ++word;
+
+            // the high bits of a value that straddles two words
+            if (shift == 0)
+            {
+                acc = {};
+            }
+            else
+            {
+                for (std::size_t lane = 0; lane < L; ++lane)
+                {
+                    acc[lane] = U(in[row * L + lane] >> (width - shift));
+                }
+            }
+        }
+    }
+}
+
+// The inverse of pack().
+template<typename U>
+constexpr void
+unpack(const U* __restrict const in, const std::size_t width, U* __restrict const out) noexcept
+{
+    constexpr auto bits = std::size_t(std::numeric_limits<U>::digits);
+    constexpr auto L = lanes<U>;
+
+    if (width == 0)
+    {
+        std::fill(out, out + block_size, U(0));
+        return;
+    }
+
+    const U mask = low_mask<U>(width);
+    std::size_t shift = 0;
+    std::size_t word = 0;
+    for (std::size_t row = 0; row < bits; ++row)
+    {
+        if (shift + width > bits)
+        {
+            for (std::size_t lane = 0; lane < L; ++lane)
+            {
+                out[row * L + lane] = U((U(in[word * L + lane] >> shift) |
+                                         U(in[(word + 1) * L + lane] << (bits - shift))) &
+                                        mask);
+            }
+        }
+        else
+        {
+            for (std::size_t lane = 0; lane < L; ++lane)
+            {
+                out[row * L + lane] = U(U(in[word * L + lane] >> shift) & mask);
+            }
+        }
+
+        shift += width;
+        if (shift >= bits)
+        {
+            shift -= bits;
+            ++word;
+        }
+    }
+}
+} // namespace detail::packing
+
+/**
+ * @brief packed_integers
+ *
+ *  - An immutable, compressed sequence of integers. Any block of 128 values
+ *    can be decoded on its own.
+ */
+template<typename Integer, packing Mode = packing::frame_of_reference> class packed_integers final
+{
+  public:
+    using value_type = Integer;
+    using integer_type = typename Integer::integer_type;
+    static constexpr packing mode = Mode;
+    static constexpr std::size_t block_size = detail::packing::block_size;
+
+    constexpr packed_integers() noexcept = default;
+
+    /**
+     * @brief encode
+     *
+     * @param[in] values The integers to compress
+     */
+    [[nodiscard]] static constexpr packed_integers
+    encode(const std::span<const Integer> values)
+    {
+        constexpr auto max_words = std::numeric_limits<unsigned_type>::digits * lanes;
+
+        packed_integers result;
+        result.size_ = values.size();
+        result.blocks_.reserve(result.blocks());
+        result.words_.reserve(result.blocks() * max_words);
+
+        std::array<Integer, block_size> padded;
+        std::array<word_type, block_size> offsets;
+        for (std::size_t base = 0; base < values.size(); base += block_size)
+        {
+            const auto count = std::min(block_size, values.size() - base);
+
+            // a partial block is padded with values that do not widen it, so
+            // that every block is encoded by the same fixed size loops.
+            const Integer* block = values.data() + base;
+            if (count != block_size)
+            {
+                std::copy_n(block, count, padded.begin());
+                for (std::size_t i = count; i < block_size; ++i)
+                {
+                    if constexpr (Mode == packing::frame_of_reference)
+                    {
+                        padded[i] = padded[0];
+                    }
+                    else
+                    {
+                        // repeat the last difference
+                        padded[i] = count == 1 ? padded[0]
+                                               : Integer(integer_type(unsigned_type(
+                                                     unsigned_type(padded[i - 1].data()) +
+                                                     difference(padded[count - 2],
+                                                                padded[count - 1]))));
+                    }
+                }
+                block = padded.data();
+            }
+
+            header h = encode_block(std::span<const Integer, block_size>(block, block_size),
+                                    offsets);
+            h.offset = result.words_.size();
+
+            result.words_.resize(result.words_.size() + h.width * lanes);
+            detail::packing::pack(offsets.data(), h.width, result.words_.data() + h.offset);
+            result.blocks_.push_back(h);
+        }
+        result.words_.shrink_to_fit();
+        return result;
+    }
+
+    /**
+     * @return the number of integers
+     */
+    [[nodiscard]] constexpr std::size_t
+    size() const noexcept
+    {
+        return this->size_;
+    }
+
+    [[nodiscard]] constexpr bool
+    empty() const noexcept
+    {
+        return this->size_ == 0;
+    }
+
+    /**
+     * @return the number of blocks, the last one may hold fewer than block_size integers
+     */
+    [[nodiscard]] constexpr std::size_t
+    blocks() const noexcept
+    {
+        return (this->size_ + block_size - 1) / block_size;
+    }
+
+    /**
+     * @return the number of integers in block
+     */
+    [[nodiscard]] constexpr std::size_t
+    block_length(const std::size_t block) const noexcept
+    {
+        ztd::panic_if(block >= this->blocks(), "block out of range");
+
+        return std::min(block_size, this->size_ - block * block_size);
+    }
+
+    /**
+     * @return the size of the compressed data in bytes
+     */
+    [[nodiscard]] constexpr std::size_t
+    size_bytes() const noexcept
+    {
+        return this->words_.size() * sizeof(word_type) + this->blocks_.size() * sizeof(header);
+    }
+
+    /**
+     * @brief decode_block
+     *
+     *  - Decode a single block without touching any other block.
+     *
+     * @param[in] block The index of the block
+     * @param[out] out Receives the integers, must hold at least block_length(block)
+     *
+     * @return the number of integers written
+     */
+    constexpr std::size_t
+    decode_block(const std::size_t block, const std::span<Integer> out) const noexcept
+    {
+        const auto count = this->block_length(block);
+        ztd::panic_if(out.size() < count, "output span is too small");
+
+        const header& h = this->blocks_[block];
+
+        std::array<word_type, block_size> offsets;
+        detail::packing::unpack(this->words_.data() + h.offset, h.width, offsets.data());
+
+        if constexpr (Mode == packing::frame_of_reference)
+        {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                out[i] = Integer(integer_type(unsigned_type(h.reference + offsets[i])));
+            }
+        }
+        else
+        {
+            unsigned_type value = h.reference;
+            out[0] = Integer(integer_type(value));
+            for (std::size_t i = 1; i < count; ++i)
+            {
+                value = unsigned_type(value + unsigned_type(offsets[i]) + h.step);
+                out[i] = Integer(integer_type(value));
+            }
+        }
+        return count;
+    }
+
+    /**
+     * @brief decode
+     *
+     * @return all of the integers
+     */
+    [[nodiscard]] constexpr std::vector<Integer>
+    decode() const
+    {
+        std::vector<Integer> result(this->size_);
+        for (std::size_t block = 0; block < this->blocks(); ++block)
+        {
+            (void)this->decode_block(block, std::span(result).subspan(block * block_size));
+        }
+        return result;
+    }
+
+    /**
+     * @return the integer at index, decoding only the block it is in
+     */
+    [[nodiscard]] constexpr Integer
+    at(const std::size_t index) const noexcept
+    {
+        ztd::panic_if(index >= this->size_, "index out of range");
+
+        std::array<Integer, block_size> block;
+        (void)this->decode_block(index / block_size, block);
+        return block[index % block_size];
+    }
+
+  private:
+    using unsigned_type = std::make_unsigned_t<integer_type>;
+    using word_type = detail::packing::word_t<integer_type>;
+    static constexpr std::size_t lanes = detail::packing::lanes<word_type>;
+
+    struct header final
+    {
+        unsigned_type reference;
+        unsigned_type step;
+        std::uint8_t width;
+        std::size_t offset;
+    };
+
+    [[nodiscard]] static constexpr unsigned_type
+    difference(const Integer prev, const Integer next) noexcept
+    {
+        return unsigned_type(unsigned_type(next.data()) - unsigned_type(prev.data()));
+    }
+
+    // The reference, step and width of a block, and its offsets.
+    [[nodiscard]] static constexpr header
+    encode_block(const std::span<const Integer, block_size> block,
+                 const std::span<word_type, block_size> offsets) noexcept
+    {
+        header h{};
+        if constexpr (Mode == packing::frame_of_reference)
+        {
+            // in the order of integer_type
+            integer_type lo = block[0].data();
+            integer_type hi = block[0].data();
+            for (std::size_t i = 0; i < block_size; ++i)
+            {
+                lo = std::min(lo, block[i].data());
+                hi = std::max(hi, block[i].data());
+            }
+            h.reference = unsigned_type(lo);
+            h.width = std::uint8_t(std::bit_width(unsigned_type(unsigned_type(hi) - h.reference)));
+
+            for (std::size_t i = 0; i < block_size; ++i)
+            {
+                offsets[i] = unsigned_type(unsigned_type(block[i].data()) - h.reference);
+            }
+        }
+        else
+        {
+            // wrapping differences, so that decreasing values still round trip
+            offsets[0] = 0;
+            for (std::size_t i = 1; i < block_size; ++i)
+            {
+                offsets[i] = difference(block[i - 1], block[i]);
+            }
+
+            unsigned_type lo = unsigned_type(offsets[1]);
+            unsigned_type hi = unsigned_type(offsets[1]);
+            for (std::size_t i = 1; i < block_size; ++i)
+            {
+                lo = std::min(lo, unsigned_type(offsets[i]));
+                hi = std::max(hi, unsigned_type(offsets[i]));
+            }
+            h.reference = unsigned_type(block[0].data());
+            h.step = lo;
+            h.width = std::uint8_t(std::bit_width(unsigned_type(hi - lo)));
+
+            for (std::size_t i = 1; i < block_size; ++i)
+            {
+                offsets[i] = unsigned_type(offsets[i] - lo);
+            }
+        }
+        return h;
+    }
+
+    std::size_t size_ = 0;
+    std::vector<header> blocks_;
+    std::vector<word_type> words_;
+};
+} // namespace ztd
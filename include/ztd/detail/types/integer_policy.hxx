@@ -0,0 +1,543 @@
+/**
+ * Copyright (C) 2025 Brandon Zorn <brandonzorn@cock.li>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <compare>
+#include <concepts>
+#include <format>
+#include <functional>
+#include <utility>
+
+#if defined(ZTD_TEST_SUITE)
+#include <ostream>
+#endif
+
+#include "../concepts.hxx"
+#include "integer.hxx"
+#include "integer_type.hxx"
+
+// ztd::integer with the math mode fixed by the type instead of ZTD_DEFAULT_MATH_MODE.
+//
+//   ztd::wrapping<ztd::u64>   - wraps around at the boundary of the type, never panics on overflow
+//   ztd::saturating<ztd::u64> - clamps to MIN()/MAX(), never panics on overflow
+//   ztd::strict<ztd::u64>     - panics on overflow
+//
+// Division by zero always panics.
+
+namespace ztd
+{
+namespace detail
+{
+template<typename Policy>
+concept is_math_policy = std::same_as<Policy, math_strict> ||
+                         std::same_as<Policy, math_overflow> ||
+                         std::same_as<Policy, math_saturating>;
+
+template<typename Policy> struct math_policy;
+
+template<> struct math_policy<math_strict>
+{
+    template<typename Integer, typename T>
+    [[nodiscard]] static constexpr Integer
+    create(const T v) noexcept
+    {
+        return Integer::strict_create(v);
+    }
+
+    template<typename Integer>
+    [[nodiscard]] static constexpr Integer
+    add(const Integer lhs, const Integer rhs) noexcept
+    {
+        return lhs.strict_add(rhs);
+    }
+
+    template<typename Integer>
+    [[nodiscard]] static constexpr Integer
+    sub(const Integer lhs, const Integer rhs) noexcept
+    {
+        return lhs.strict_sub(rhs);
+    }
+
+    template<typename Integer>
+    [[nodiscard]] static constexpr Integer
+    mul(const Integer lhs, const Integer rhs) noexcept
+    {
+        return lhs.strict_mul(rhs);
+    }
+
+    template<typename Integer>
+    [[nodiscard]] static constexpr Integer
+    div(const Integer lhs, const Integer rhs) noexcept
+    {
+        return lhs.strict_div(rhs);
+    }
+
+    template<typename Integer>
+    [[nodiscard]] static constexpr Integer
+    rem(const Integer lhs, const Integer rhs) noexcept
+    {
+        return lhs.strict_rem(rhs);
+    }
+
+    template<typename Integer>
+    [[nodiscard]] static constexpr Integer
+    neg(const Integer value) noexcept
+    {
+        return value.strict_neg();
+    }
+};
+
+template<> struct math_policy<math_overflow>
+{
+    template<typename Integer, typename T>
+    [[nodiscard]] static constexpr Integer
+    create(const T v) noexcept
+    {
+        return Integer::unchecked_create(v);
+    }
+
+    template<typename Integer>
+    [[nodiscard]] static constexpr Integer
+    add(const Integer lhs, const Integer rhs) noexcept
+    {
+        return lhs.wrapping_add(rhs);
+    }
+
+    template<typename Integer>
+    [[nodiscard]] static constexpr Integer
+    sub(const Integer lhs, const Integer rhs) noexcept
+    {
+        return lhs.wrapping_sub(rhs);
+    }
+
+    template<typename Integer>
+    [[nodiscard]] static constexpr Integer
+    mul(const Integer lhs, const Integer rhs) noexcept
+    {
+        return lhs.wrapping_mul(rhs);
+    }
+
+    template<typename Integer>
+    [[nodiscard]] static constexpr Integer
+    div(const Integer lhs, const Integer rhs) noexcept
+    {
+        return lhs.wrapping_div(rhs);
+    }
+
+    template<typename Integer>
+    [[nodiscard]] static constexpr Integer
+    rem(const Integer lhs, const Integer rhs) noexcept
+    {
+        return lhs.wrapping_rem(rhs);
+    }
+
+    template<typename Integer>
+    [[nodiscard]] static constexpr Integer
+    neg(const Integer value) noexcept
+    {
+        return value.wrapping_neg();
+    }
+};
+
+template<> struct math_policy<math_saturating>
+{
+    template<typename Integer, typename T>
+    [[nodiscard]] static constexpr Integer
+    create(const T v) noexcept
+    {
+        return Integer::saturating_create(v);
+    }
+
+    template<typename Integer>
+    [[nodiscard]] static constexpr Integer
+    add(const Integer lhs, const Integer rhs) noexcept
+    {
+        return lhs.saturating_add(rhs);
+    }
+
+    template<typename Integer>
+    [[nodiscard]] static constexpr Integer
+    sub(const Integer lhs, const Integer rhs) noexcept
+    {
+        return lhs.saturating_sub(rhs);
+    }
+
+    template<typename Integer>
+    [[nodiscard]] static constexpr Integer
+    mul(const Integer lhs, const Integer rhs) noexcept
+    {
+        return lhs.saturating_mul(rhs);
+    }
+
+    template<typename Integer>
+    [[nodiscard]] static constexpr Integer
+    div(const Integer lhs, const Integer rhs) noexcept
+    {
+        return lhs.saturating_div(rhs);
+    }
+
+    template<typename Integer>
+    [[nodiscard]] static constexpr Integer
+    rem(const Integer lhs, const Integer rhs) noexcept
+    {
+        // the remainder can not overflow, MIN() % -1 is 0
+        return lhs.wrapping_rem(rhs);
+    }
+
+    template<typename Integer>
+    [[nodiscard]] static constexpr Integer
+    neg(const Integer value) noexcept
+    {
+        return value.saturating_neg();
+    }
+};
+} // namespace detail
+
+template<typename Integer, typename Policy> class policy_integer final
+{
+  public:
+    using value_type = Integer;
+    using integer_type = typename Integer::integer_type;
+    using policy = Policy;
+    static_assert(detail::is_math_policy<Policy>);
+
+    constexpr policy_integer() noexcept = default;
+
+    constexpr policy_integer(const Integer rhs) noexcept : value_(rhs) {}
+
+    template<typename T>
+    constexpr explicit policy_integer(const T rhs) noexcept
+        requires(detail::is_integer<T>)
+        : value_(math::template create<Integer>(rhs))
+    {
+    }
+
+    /**
+     * @return the wrapped integer
+     */
+    [[nodiscard]] constexpr Integer
+    value() const noexcept
+    {
+        return this->value_;
+    }
+
+    /**
+     * @return the underlying integer_type
+     */
+    [[nodiscard]] constexpr integer_type
+    data() const noexcept
+    {
+        return this->value_.data();
+    }
+
+    // unary operators
+
+    [[nodiscard]] constexpr policy_integer
+    operator+() const noexcept
+        requires(detail::is_signed_integer<integer_type>)
+    {
+        return *this;
+    }
+
+    [[nodiscard]] constexpr policy_integer
+    operator-() const noexcept
+        requires(detail::is_signed_integer<integer_type>)
+    {
+        return math::neg(this->value_);
+    }
+
+    // increment/decrement operators
+
+    constexpr policy_integer& operator++() = delete ("help: use '+= 1' instead");
+    constexpr policy_integer operator++(int) = delete ("help: use '+= 1' instead");
+    constexpr policy_integer& operator--() = delete ("help: use '-= 1' instead");
+    constexpr policy_integer operator--(int) = delete ("help: use '-= 1' instead");
+
+    // arithmetic operators
+
+    [[nodiscard]] friend constexpr policy_integer
+    operator+(const policy_integer lhs, const policy_integer rhs) noexcept
+    {
+        return math::add(lhs.value_, rhs.value_);
+    }
+
+    [[nodiscard]] friend constexpr policy_integer
+    operator-(const policy_integer lhs, const policy_integer rhs) noexcept
+    {
+        return math::sub(lhs.value_, rhs.value_);
+    }
+
+    [[nodiscard]] friend constexpr policy_integer
+    operator*(const policy_integer lhs, const policy_integer rhs) noexcept
+    {
+        return math::mul(lhs.value_, rhs.value_);
+    }
+
+    [[nodiscard]] friend constexpr policy_integer
+    operator/(const policy_integer lhs, const policy_integer rhs) noexcept
+    {
+        return math::div(lhs.value_, rhs.value_);
+    }
+
+    [[nodiscard]] friend constexpr policy_integer
+    operator%(const policy_integer lhs, const policy_integer rhs) noexcept
+    {
+        return math::rem(lhs.value_, rhs.value_);
+    }
+
+    template<typename T>
+    [[nodiscard]] friend constexpr policy_integer
+    operator+(const policy_integer lhs, const T rhs) noexcept
+        requires(detail::is_integer<T>)
+    {
+        return lhs + policy_integer(rhs);
+    }
+
+    template<typename T>
+    [[nodiscard]] friend constexpr policy_integer
+    operator-(const policy_integer lhs, const T rhs) noexcept
+        requires(detail::is_integer<T>)
+    {
+        return lhs - policy_integer(rhs);
+    }
+
+    template<typename T>
+    [[nodiscard]] friend constexpr policy_integer
+    operator*(const policy_integer lhs, const T rhs) noexcept
+        requires(detail::is_integer<T>)
+    {
+        return lhs * policy_integer(rhs);
+    }
+
+    template<typename T>
+    [[nodiscard]] friend constexpr policy_integer
+    operator/(const policy_integer lhs, const T rhs) noexcept
+        requires(detail::is_integer<T>)
+    {
+        return lhs / policy_integer(rhs);
+    }
+
+    template<typename T>
+    [[nodiscard]] friend constexpr policy_integer
+    operator%(const policy_integer lhs, const T rhs) noexcept
+        requires(detail::is_integer<T>)
+    {
+        return lhs % policy_integer(rhs);
+    }
+
+    template<typename T>
+    [[nodiscard]] friend constexpr policy_integer
+    operator+(const T lhs, const policy_integer rhs) noexcept
+        requires(detail::is_integer<T>)
+    {
+        return policy_integer(lhs) + rhs;
+    }
+
+    template<typename T>
+    [[nodiscard]] friend constexpr policy_integer
+    operator-(const T lhs, const policy_integer rhs) noexcept
+        requires(detail::is_integer<T>)
+    {
+        return policy_integer(lhs) - rhs;
+    }
+
+    template<typename T>
+    [[nodiscard]] friend constexpr policy_integer
+    operator*(const T lhs, const policy_integer rhs) noexcept
+        requires(detail::is_integer<T>)
+    {
+        return policy_integer(lhs) * rhs;
+    }
+
+    template<typename T>
+    [[nodiscard]] friend constexpr policy_integer
+    operator/(const T lhs, const policy_integer rhs) noexcept
+        requires(detail::is_integer<T>)
+    {
+        return policy_integer(lhs) / rhs;
+    }
+
+    template<typename T>
+    [[nodiscard]] friend constexpr policy_integer
+    operator%(const T lhs, const policy_integer rhs) noexcept
+        requires(detail::is_integer<T>)
+    {
+        return policy_integer(lhs) % rhs;
+    }
+
+    // assignment operators
+
+    constexpr policy_integer&
+    operator+=(const policy_integer rhs) noexcept
+    {
+        *this = *this + rhs;
+        return *this;
+    }
+
+    constexpr policy_integer&
+    operator-=(const policy_integer rhs) noexcept
+    {
+        *this = *this - rhs;
+        return *this;
+    }
+
+    constexpr policy_integer&
+    operator*=(const policy_integer rhs) noexcept
+    {
+        *this = *this * rhs;
+        return *this;
+    }
+
+    constexpr policy_integer&
+    operator/=(const policy_integer rhs) noexcept
+    {
+        *this = *this / rhs;
+        return *this;
+    }
+
+    constexpr policy_integer&
+    operator%=(const policy_integer rhs) noexcept
+    {
+        *this = *this % rhs;
+        return *this;
+    }
+
+    template<typename T>
+    constexpr policy_integer&
+    operator+=(const T rhs) noexcept
+        requires(detail::is_integer<T>)
+    {
+        *this = *this + policy_integer(rhs);
+        return *this;
+    }
+
+    template<typename T>
+    constexpr policy_integer&
+    operator-=(const T rhs) noexcept
+        requires(detail::is_integer<T>)
+    {
+        *this = *this - policy_integer(rhs);
+        return *this;
+    }
+
+    template<typename T>
+    constexpr policy_integer&
+    operator*=(const T rhs) noexcept
+        requires(detail::is_integer<T>)
+    {
+        *this = *this * policy_integer(rhs);
+        return *this;
+    }
+
+    template<typename T>
+    constexpr policy_integer&
+    operator/=(const T rhs) noexcept
+        requires(detail::is_integer<T>)
+    {
+        *this = *this / policy_integer(rhs);
+        return *this;
+    }
+
+    template<typename T>
+    constexpr policy_integer&
+    operator%=(const T rhs) noexcept
+        requires(detail::is_integer<T>)
+    {
+        *this = *this % policy_integer(rhs);
+        return *this;
+    }
+
+    // comparison operators
+
+    [[nodiscard]] friend constexpr bool
+    operator==(const policy_integer lhs, const policy_integer rhs) noexcept
+    {
+        return lhs.data() == rhs.data();
+    }
+
+    [[nodiscard]] friend constexpr std::strong_ordering
+    operator<=>(const policy_integer lhs, const policy_integer rhs) noexcept
+    {
+        return lhs.data() <=> rhs.data();
+    }
+
+    template<typename T>
+    [[nodiscard]] friend constexpr bool
+    operator==(const policy_integer lhs, const T rhs) noexcept
+        requires(detail::is_integer<T>)
+    {
+        return std::cmp_equal(lhs.data(), rhs);
+    }
+
+    template<typename T>
+    [[nodiscard]] friend constexpr std::strong_ordering
+    operator<=>(const policy_integer lhs, const T rhs) noexcept
+        requires(detail::is_integer<T>)
+    {
+        if (std::cmp_less(lhs.data(), rhs))
+        {
+            return std::strong_ordering::less;
+        }
+        if (std::cmp_equal(lhs.data(), rhs))
+        {
+            return std::strong_ordering::equal;
+        }
+        return std::strong_ordering::greater;
+    }
+
+#if defined(ZTD_TEST_SUITE)
+    // needed for doctest to show values
+    friend std::ostream&
+    operator<<(std::ostream& os, const policy_integer obj)
+    {
+        os << obj.value_;
+        return os;
+    }
+#endif
+
+  private:
+    using math = detail::math_policy<Policy>;
+
+    Integer value_;
+};
+
+template<typename Integer> using strict = policy_integer<Integer, detail::math_strict>;
+template<typename Integer> using wrapping = policy_integer<Integer, detail::math_overflow>;
+template<typename Integer> using saturating = policy_integer<Integer, detail::math_saturating>;
+} // namespace ztd
+
+// std::format
+template<typename Integer, typename Policy>
+struct std::formatter<ztd::policy_integer<Integer, Policy>> : std::formatter<Integer>
+{
+    auto
+    format(const ztd::policy_integer<Integer, Policy>& obj, std::format_context& ctx) const
+    {
+        return std::formatter<Integer>::format(obj.value(), ctx);
+    }
+};
+
+// std::hash
+template<typename Integer, typename Policy> struct std::hash<ztd::policy_integer<Integer, Policy>>
+{
+    typename Integer::integer_type
+    operator()(const ztd::policy_integer<Integer, Policy>& obj) const
+    {
+        return std::hash<Integer>()(obj.value());
+    }
+};
@@ -0,0 +1,273 @@
+/**
+ * Copyright (C) 2025 Brandon Zorn <brandonzorn@cock.li>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <ranges>
+#include <type_traits>
+
+#include "../panic.hxx"
+#include "integer.hxx"
+
+// A view of evenly spaced ztd::integer values, [begin, end) by step.
+//
+//   for (const auto i : ztd::range(10_u8))              // 0, 1, ..., 9
+//   for (const auto i : ztd::range(0_u8, 250_u8, 100_u8)) // 0, 100, 200
+//   for (const auto i : ztd::range(5_i32, -5_i32, -2_i32)) // 5, 3, 1, -1, -3
+//
+// The number of elements is computed once when the range is created, and the
+// iterators count elements instead of comparing values, so stepping past the
+// last value never overflows even when end is MAX() or the step does not
+// divide the distance. Being a counted loop, the compiler knows the trip count.
+//
+// The difference_type is std::int64_t, a 64 bit range can have more elements
+// than that, i.e. range(ztd::u64::MAX()). Iterating it and size() are exact,
+// the distance between two iterators (it - other) is only meaningful while it
+// fits in std::int64_t.
+
+namespace ztd
+{
+template<typename Tag> class range final : public std::ranges::view_interface<range<Tag>>
+{
+  public:
+    using value_type = integer<Tag>;
+    using integer_type = typename integer<Tag>::integer_type;
+    using size_type = std::uint64_t;
+    using difference_type = std::int64_t;
+
+  private:
+    // wide enough that the arithmetic is not promoted to int
+    using unsigned_type = std::conditional_t<(sizeof(integer_type) < sizeof(unsigned int)),
+                                             unsigned int, std::make_unsigned_t<integer_type>>;
+
+  public:
+    class iterator final
+    {
+      public:
+        using iterator_concept = std::random_access_iterator_tag;
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = integer<Tag>;
+        using difference_type = range::difference_type;
+
+        constexpr iterator() noexcept = default;
+
+        [[nodiscard]] constexpr value_type
+        operator*() const noexcept
+        {
+            const auto offset = unsigned_type(this->step_ * this->index_);
+            return value_type(integer_type(unsigned_type(this->begin_ + offset)));
+        }
+
+        [[nodiscard]] constexpr value_type
+        operator[](const difference_type n) const noexcept
+        {
+            return *(*this + n);
+        }
+
+        constexpr iterator&
+        operator++() noexcept
+        {
+            ++this->index_;
+            return *this;
+        }
+
+        constexpr iterator
+        operator++(int) noexcept
+        {
+            auto tmp = *this;
+            ++this->index_;
+            return tmp;
+        }
+
+        constexpr iterator&
+        operator--() noexcept
+        {
+            --this->index_;
+            return *this;
+        }
+
+        constexpr iterator
+        operator--(int) noexcept
+        {
+            auto tmp = *this;
+            --this->index_;
+            return tmp;
+        }
+
+        constexpr iterator&
+        operator+=(const difference_type n) noexcept
+        {
+            // modular, so that an index above the difference_type max still moves
+            this->index_ = unsigned_type(this->index_ + unsigned_type(n));
+            return *this;
+        }
+
+        constexpr iterator&
+        operator-=(const difference_type n) noexcept
+        {
+            this->index_ = unsigned_type(this->index_ - unsigned_type(n));
+            return *this;
+        }
+
+        [[nodiscard]] friend constexpr iterator
+        operator+(iterator it, const difference_type n) noexcept
+        {
+            it += n;
+            return it;
+        }
+
+        [[nodiscard]] friend constexpr iterator
+        operator+(const difference_type n, iterator it) noexcept
+        {
+            it += n;
+            return it;
+        }
+
+        [[nodiscard]] friend constexpr iterator
+        operator-(iterator it, const difference_type n) noexcept
+        {
+            it -= n;
+            return it;
+        }
+
+        // wraps around if the distance does not fit in difference_type
+        [[nodiscard]] friend constexpr difference_type
+        operator-(const iterator& lhs, const iterator& rhs) noexcept
+        {
+            return difference_type(std::uint64_t(lhs.index_) - std::uint64_t(rhs.index_));
+        }
+
+        [[nodiscard]] friend constexpr bool
+        operator==(const iterator& lhs, const iterator& rhs) noexcept
+        {
+            return lhs.index_ == rhs.index_;
+        }
+
+        [[nodiscard]] friend constexpr auto
+        operator<=>(const iterator& lhs, const iterator& rhs) noexcept
+        {
+            return lhs.index_ <=> rhs.index_;
+        }
+
+      private:
+        friend class range;
+
+        constexpr iterator(const unsigned_type begin,
+                           const unsigned_type step,
+                           const unsigned_type index) noexcept
+            : begin_(begin), step_(step), index_(index)
+        {
+        }
+
+        // the index has the width of the values, so that the loop has a
+        // single induction variable of that width.
+        unsigned_type begin_ = 0;
+        unsigned_type step_ = 0;
+        unsigned_type index_ = 0;
+    };
+
+    constexpr range() noexcept = default;
+
+    /**
+     * @brief range
+     *
+     *  - [0, end) by 1
+     */
+    constexpr explicit range(const integer<Tag> end) noexcept
+        : range(integer<Tag>(integer_type(0)), end, integer<Tag>(integer_type(1)))
+    {
+    }
+
+    /**
+     * @brief range
+     *
+     *  - [begin, end) by step, step can be negative to count down. Panics if
+     *    step is 0.
+     */
+    constexpr range(const integer<Tag> begin,
+                    const integer<Tag> end,
+                    const integer<Tag> step = integer<Tag>(integer_type(1))) noexcept
+        : begin_(unsigned_type(std::make_unsigned_t<integer_type>(begin.data()))),
+          step_(unsigned_type(std::make_unsigned_t<integer_type>(step.data())))
+    {
+        using unsigned_integer_type = std::make_unsigned_t<integer_type>;
+
+        ztd::panic_if(step == 0, "range step can not be 0");
+
+        // the distance and the magnitude of the step always fit in the
+        // unsigned type, even when they do not fit in integer_type.
+        unsigned_integer_type distance = 0;
+        unsigned_integer_type magnitude = 0;
+        if (step > 0)
+        {
+            if (begin < end)
+            {
+                distance = unsigned_integer_type(unsigned_integer_type(end.data()) -
+                                                 unsigned_integer_type(begin.data()));
+            }
+            magnitude = unsigned_integer_type(step.data());
+        }
+        else
+        {
+            if (begin > end)
+            {
+                distance = unsigned_integer_type(unsigned_integer_type(begin.data()) -
+                                                 unsigned_integer_type(end.data()));
+            }
+            magnitude = unsigned_integer_type(unsigned_integer_type(0) -
+                                              unsigned_integer_type(step.data()));
+        }
+        if (distance != 0)
+        {
+            this->size_ = unsigned_type(unsigned_type((distance - 1u) / magnitude) + 1u);
+        }
+    }
+
+    [[nodiscard]] constexpr iterator
+    begin() const noexcept
+    {
+        return iterator(this->begin_, this->step_, 0);
+    }
+
+    [[nodiscard]] constexpr iterator
+    end() const noexcept
+    {
+        return iterator(this->begin_, this->step_, this->size_);
+    }
+
+    /**
+     * @return the number of values in the range, which can be more than the
+     * difference_type max for a 64 bit range
+     */
+    [[nodiscard]] constexpr size_type
+    size() const noexcept
+    {
+        return this->size_;
+    }
+
+  private:
+    unsigned_type begin_ = 0;
+    unsigned_type step_ = 1;
+    unsigned_type size_ = 0;
+};
+} // namespace ztd
+
+template<typename Tag>
+inline constexpr bool std::ranges::enable_borrowed_range<ztd::range<Tag>> = true;
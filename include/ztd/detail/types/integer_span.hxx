@@ -0,0 +1,1177 @@
+/**
+ * Copyright (C) 2025 Brandon Zorn <brandonzorn@cock.li>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <cstring>
+#include <expected>
+#include <limits>
+#include <optional>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "../concepts.hxx"
+#include "../panic.hxx"
+#include "../random.hxx"
+#include "integer.hxx"
+
+// Zero-copy views and bulk operations over std::span<ztd::integer<Tag>>.
+//
+// The bulk kernels are written as straight-line, branch-free loops over the
+// raw integer_type so that the compiler can auto-vectorize them for
+// whatever ISA the translation unit is built for. Overflow in the
+// checked kernels is reduced once per block instead of once per element.
+
+namespace ztd
+{
+namespace detail
+{
+// ztd::integer<Tag> is a thin wrapper around a single integer_type, and has to
+// stay that way so that buffers of raw integers can be viewed as integers.
+template<typename Integer>
+concept is_layout_compatible_integer =
+    std::is_standard_layout_v<Integer> && std::is_trivially_copyable_v<Integer> &&
+    sizeof(Integer) == sizeof(typename Integer::integer_type) &&
+    alignof(Integer) == alignof(typename Integer::integer_type);
+} // namespace detail
+
+/**
+ * @brief as_integers
+ *
+ *  - View a span of raw integers as a span of ztd::integer without copying,
+ *    i.e. a mmapped file or a network buffer of std::uint64_t as ztd::u64.
+ *
+ * @param[in] s The raw integers, must be of type Integer::integer_type
+ *
+ * @return a span of Integer over the same memory as s
+ */
+template<typename Integer, typename T, std::size_t Extent>
+[[nodiscard]] inline auto
+as_integers(const std::span<T, Extent> s) noexcept
+    requires(std::same_as<std::remove_const_t<T>, typename Integer::integer_type>)
+{
+    static_assert(detail::is_layout_compatible_integer<Integer>);
+
+    using value_type = std::conditional_t<std::is_const_v<T>, const Integer, Integer>;
+    return std::span<value_type, Extent>(reinterpret_cast<value_type*>(s.data()), s.size());
+}
+
+/**
+ * @brief as_raw
+ *
+ *  - View a span of ztd::integer as a span of the underlying raw integers
+ *    without copying, i.e. to hand the buffer to a C API or write it to disk.
+ *
+ * @param[in] s The integers
+ *
+ * @return a span of integer_type over the same memory as s
+ */
+template<typename Tag, std::size_t Extent>
+[[nodiscard]] inline std::span<typename integer<Tag>::integer_type, Extent>
+as_raw(const std::span<integer<Tag>, Extent> s) noexcept
+{
+    static_assert(detail::is_layout_compatible_integer<integer<Tag>>);
+
+    using value_type = typename integer<Tag>::integer_type;
+    return std::span<value_type, Extent>(reinterpret_cast<value_type*>(s.data()), s.size());
+}
+
+/**
+ * @brief as_raw
+ *
+ *  - View a span of ztd::integer as a span of the underlying raw integers
+ *    without copying, i.e. to hand the buffer to a C API or write it to disk.
+ *
+ * @param[in] s The integers
+ *
+ * @return a span of integer_type over the same memory as s
+ */
+template<typename Tag, std::size_t Extent>
+[[nodiscard]] inline std::span<const typename integer<Tag>::integer_type, Extent>
+as_raw(const std::span<const integer<Tag>, Extent> s) noexcept
+{
+    static_assert(detail::is_layout_compatible_integer<integer<Tag>>);
+
+    using value_type = const typename integer<Tag>::integer_type;
+    return std::span<value_type, Extent>(reinterpret_cast<value_type*>(s.data()), s.size());
+}
+
+namespace detail::bulk
+{
+// number of elements processed between overflow checks.
+inline constexpr std::size_t block_size = 64;
+
+// Unsigned type wide enough to avoid integer promotion to int.
+template<typename T>
+using unsigned_t = std::conditional_t<(sizeof(T) < sizeof(unsigned int)), unsigned int,
+                                      std::make_unsigned_t<T>>;
+
+template<typename T>
+[[nodiscard]] constexpr T
+wrapping_add(const T a, const T b) noexcept
+{
+    return static_cast<T>(static_cast<unsigned_t<T>>(a) + static_cast<unsigned_t<T>>(b));
+}
+
+template<typename T>
+[[nodiscard]] constexpr T
+wrapping_sub(const T a, const T b) noexcept
+{
+    return static_cast<T>(static_cast<unsigned_t<T>>(a) - static_cast<unsigned_t<T>>(b));
+}
+
+template<typename T>
+[[nodiscard]] constexpr T
+wrapping_mul(const T a, const T b) noexcept
+{
+    return static_cast<T>(static_cast<unsigned_t<T>>(a) * static_cast<unsigned_t<T>>(b));
+}
+
+template<typename T>
+[[nodiscard]] constexpr std::tuple<T, bool>
+overflowing_add(const T a, const T b) noexcept
+{
+    const T r = wrapping_add(a, b);
+    if constexpr (is_signed_integer<T>)
+    {
+        // overflow only if both operands have the same sign and the result does not.
+        return {r, static_cast<T>((a ^ r) & (b ^ r)) < 0};
+    }
+    else
+    {
+        return {r, r < a};
+    }
+}
+
+template<typename T>
+[[nodiscard]] constexpr std::tuple<T, bool>
+overflowing_sub(const T a, const T b) noexcept
+{
+    const T r = wrapping_sub(a, b);
+    if constexpr (is_signed_integer<T>)
+    {
+        // overflow only if the operands have different signs and the result
+        // does not have the sign of a.
+        return {r, static_cast<T>((a ^ b) & (a ^ r)) < 0};
+    }
+    else
+    {
+        return {r, a < b};
+    }
+}
+
+template<typename T>
+[[nodiscard]] constexpr std::tuple<T, bool>
+overflowing_mul(const T a, const T b) noexcept
+{
+    if constexpr (sizeof(T) < sizeof(std::int64_t))
+    {
+        // widening multiply, the product always fits in 64 bits.
+        using wide = std::conditional_t<is_signed_integer<T>, std::int64_t, std::uint64_t>;
+        const wide r = static_cast<wide>(a) * static_cast<wide>(b);
+        return {static_cast<T>(r), r != static_cast<wide>(static_cast<T>(r))};
+    }
+    else
+    {
+        T r;
+        const bool overflow = __builtin_mul_overflow(a, b, &r);
+        return {r, overflow};
+    }
+}
+
+// The value an operation saturates to, based on the sign of the true result.
+template<typename T>
+[[nodiscard]] constexpr T
+saturated(const bool negative) noexcept
+{
+    return negative ? std::numeric_limits<T>::min() : std::numeric_limits<T>::max();
+}
+
+template<typename T>
+[[nodiscard]] constexpr T
+saturating_add(const T a, const T b) noexcept
+{
+    const auto [r, overflow] = overflowing_add(a, b);
+    if constexpr (is_signed_integer<T>)
+    {
+        return overflow ? saturated<T>(a < 0) : r;
+    }
+    else
+    {
+        return overflow ? std::numeric_limits<T>::max() : r;
+    }
+}
+
+template<typename T>
+[[nodiscard]] constexpr T
+saturating_sub(const T a, const T b) noexcept
+{
+    const auto [r, overflow] = overflowing_sub(a, b);
+    if constexpr (is_signed_integer<T>)
+    {
+        return overflow ? saturated<T>(a < 0) : r;
+    }
+    else
+    {
+        return overflow ? std::numeric_limits<T>::min() : r;
+    }
+}
+
+template<typename T>
+[[nodiscard]] constexpr T
+saturating_mul(const T a, const T b) noexcept
+{
+    const auto [r, overflow] = overflowing_mul(a, b);
+    if constexpr (is_signed_integer<T>)
+    {
+        return overflow ? saturated<T>((a < 0) != (b < 0)) : r;
+    }
+    else
+    {
+        return overflow ? std::numeric_limits<T>::max() : r;
+    }
+}
+
+template<typename Tag, typename Op>
+constexpr void
+transform(const std::span<integer<Tag>> lhs, const std::span<const integer<Tag>> rhs,
+          const Op op) noexcept
+{
+    ztd::panic_if(lhs.size() != rhs.size(), "span sizes do not match");
+
+    for (std::size_t i = 0; i < lhs.size(); ++i)
+    {
+        lhs[i] = integer<Tag>(op(lhs[i].data(), rhs[i].data()));
+    }
+}
+
+template<typename Tag, typename Op>
+[[nodiscard]] constexpr std::expected<void, std::size_t>
+checked_transform(const std::span<integer<Tag>> lhs, const std::span<const integer<Tag>> rhs,
+                  const Op op) noexcept
+{
+    using integer_type = typename integer<Tag>::integer_type;
+
+    ztd::panic_if(lhs.size() != rhs.size(), "span sizes do not match");
+
+    std::array<integer_type, block_size> results{};
+    for (std::size_t base = 0; base < lhs.size(); base += block_size)
+    {
+        const auto count = std::min(block_size, lhs.size() - base);
+
+        bool overflow = false;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const auto [r, o] = op(lhs[base + i].data(), rhs[base + i].data());
+            results[i] = r;
+            overflow |= o;
+        }
+
+        if (overflow) [[unlikely]]
+        {
+            // slow path, commit everything before the first overflow.
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const auto [r, o] = op(lhs[base + i].data(), rhs[base + i].data());
+                if (o)
+                {
+                    return std::unexpected(base + i);
+                }
+                lhs[base + i] = integer<Tag>(r);
+            }
+        }
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            lhs[base + i] = integer<Tag>(results[i]);
+        }
+    }
+    return {};
+}
+
+// The range of To, expressed in From.
+template<typename To, typename From>
+inline constexpr From cast_min = std::in_range<From>(std::numeric_limits<To>::min())
+                                     ? From(std::numeric_limits<To>::min())
+                                     : std::numeric_limits<From>::min();
+
+template<typename To, typename From>
+inline constexpr From cast_max = std::in_range<From>(std::numeric_limits<To>::max())
+                                     ? From(std::numeric_limits<To>::max())
+                                     : std::numeric_limits<From>::max();
+
+// std::popcount is a single instruction with POPCNT, and AVX-512 VPOPCNT
+// vectorizes a plain popcount loop. Without either, or with AVX2 where the
+// scalar POPCNT is the bottleneck, a SWAR count that accumulates per-byte
+// counts vectorizes to byte shuffles and adds and is faster.
+#if defined(__AVX512VPOPCNTDQ__) || (defined(__POPCNT__) && !defined(__AVX2__))
+inline constexpr bool native_popcount = true;
+#else
+inline constexpr bool native_popcount = false;
+#endif
+
+// Per-byte counts of the ones in x, every byte is at most 8.
+template<typename U>
+[[nodiscard]] constexpr U
+popcount_bytes(U x) noexcept
+{
+    constexpr U ones = U(~U(0)) / U(0xff);
+
+    x = x - ((x >> 1) & U(ones * 0x55));
+    x = (x & U(ones * 0x33)) + ((x >> 2) & U(ones * 0x33));
+    return (x + (x >> 4)) & U(ones * 0x0f);
+}
+
+template<typename T>
+[[nodiscard]] constexpr std::size_t
+count_ones(const std::span<const T> in) noexcept
+{
+    using U = unsigned_t<T>;
+
+    if constexpr (native_popcount)
+    {
+        std::size_t total = 0;
+        for (const auto value : in)
+        {
+            total += std::size_t(std::popcount(static_cast<std::make_unsigned_t<T>>(value)));
+        }
+        return total;
+    }
+    else
+    {
+        // byte lanes hold at most 8 per word, so 31 words fit before they
+        // have to be folded into 16 bit lanes.
+        constexpr std::size_t words = 31;
+        constexpr U low_bytes = U(~U(0)) / U(0xffff) * U(0xff);
+        constexpr U low_shorts = U(~U(0)) / U(0xffff);
+
+        std::size_t total = 0;
+        for (std::size_t base = 0; base < in.size(); base += words)
+        {
+            const auto count = std::min(words, in.size() - base);
+
+            U acc = 0;
+            for (std::size_t i = base; i < base + count; ++i)
+            {
+                acc += popcount_bytes(static_cast<U>(static_cast<std::make_unsigned_t<T>>(in[i])));
+            }
+            acc = (acc & low_bytes) + ((acc >> 8) & low_bytes);
+            total += std::size_t(U(acc * low_shorts) >> (std::numeric_limits<U>::digits - 16));
+        }
+        return total;
+    }
+}
+
+// Index of the first bit at or after from that differs from flip, or
+// nullopt. Whole blocks of words equal to flip are skipped with a vectorized
+// or reduction.
+template<typename T>
+[[nodiscard]] constexpr std::optional<std::size_t>
+find_next(const std::span<const T> in, const std::size_t from, const bool set) noexcept
+{
+    using U = std::make_unsigned_t<T>;
+
+    constexpr std::size_t bits = std::numeric_limits<U>::digits;
+    const U flip = set ? U(0) : U(~U(0));
+
+    std::size_t word = from / bits;
+    if (word >= in.size())
+    {
+        return std::nullopt;
+    }
+
+    // the partial first word
+    const U first = U(U(static_cast<U>(in[word]) ^ flip) & U(~U(0) << (from % bits)));
+    if (first != 0)
+    {
+        return word * bits + std::size_t(std::countr_zero(first));
+    }
+    ++word;
+
+    for (; word < in.size(); word += block_size)
+    {
+        const auto count = std::min(block_size, in.size() - word);
+
+        U any = 0;
+        for (std::size_t i = word; i < word + count; ++i)
+        {
+            any |= U(static_cast<U>(in[i]) ^ flip);
+        }
+
+        if (any != 0)
+        {
+            for (std::size_t i = word; i < word + count; ++i)
+            {
+                const U value = U(static_cast<U>(in[i]) ^ flip);
+                if (value != 0)
+                {
+                    return i * bits + std::size_t(std::countr_zero(value));
+                }
+            }
+        }
+    }
+    return std::nullopt;
+}
+// Every bit of a draw is used, 64 / BITS values per draw. Whole draws are
+// copied as is, the partial draw at the end is split low bits first.
+template<typename T, typename Engine>
+inline void
+fill_random_bits(const std::span<T> out, Engine& engine) noexcept
+{
+    using U = std::make_unsigned_t<T>;
+
+    constexpr std::size_t bits = std::numeric_limits<U>::digits;
+    constexpr std::size_t per_draw = 64 / bits;
+
+    std::size_t i = 0;
+    for (; i + per_draw <= out.size(); i += per_draw)
+    {
+        const std::uint64_t draw = engine();
+        std::memcpy(out.data() + i, &draw, sizeof(draw));
+    }
+    if (i < out.size())
+    {
+        const std::uint64_t draw = engine();
+        for (std::size_t j = 0; i + j < out.size(); ++j)
+        {
+            out[i + j] = static_cast<T>(U(draw >> (j * bits)));
+        }
+    }
+}
+
+// out[i] = min + a uniform value in [0, bound), using Lemire's method with the
+// rejection threshold computed once for the whole span instead of once per
+// biased draw. Values that fit in 32 bits take two candidates from each draw.
+template<typename T, typename Engine>
+inline void
+fill_random_bounded(const std::span<T> out,
+                    const T min,
+                    const std::uint64_t bound,
+                    Engine& engine) noexcept
+{
+    using U = std::make_unsigned_t<T>;
+
+    const auto base = static_cast<U>(min);
+    std::size_t i = 0;
+    if constexpr (sizeof(T) <= sizeof(std::uint32_t))
+    {
+        const auto bound32 = std::uint32_t(bound);
+        const auto threshold = std::uint32_t(-bound32) % bound32;
+        while (i < out.size())
+        {
+            const std::uint64_t draw = engine();
+            for (std::size_t half = 0; half < 2 && i < out.size(); ++half)
+            {
+                const auto m = std::uint64_t(std::uint32_t(draw >> (half * 32))) * bound32;
+                if (std::uint32_t(m) >= threshold)
+                {
+                    out[i++] = static_cast<T>(U(base + U(m >> 32)));
+                }
+            }
+        }
+    }
+    else
+    {
+        const auto threshold = -bound % bound;
+        while (i < out.size())
+        {
+            const auto m = detail::prng::uint128(engine()) * bound;
+            if (std::uint64_t(m) >= threshold)
+            {
+                out[i++] = static_cast<T>(U(base + U(m >> 64)));
+            }
+        }
+    }
+}
+} // namespace detail::bulk
+
+/**
+ * @brief wrapping_add - element-wise wrapping (modular) addition
+ *
+ *  - lhs[i] = lhs[i] + rhs[i], wrapping around at the boundary of the type.
+ *
+ * @param[in,out] lhs The values to add to, receives the result
+ * @param[in] rhs The values to add, must be the same size as lhs
+ */
+template<typename Tag>
+constexpr void
+wrapping_add(const std::span<integer<Tag>> lhs,
+             const std::type_identity_t<std::span<const integer<Tag>>> rhs) noexcept
+{
+    detail::bulk::transform(lhs, rhs,
+                            [](const auto a, const auto b)
+                            { return detail::bulk::wrapping_add(a, b); });
+}
+
+/**
+ * @brief wrapping_sub - element-wise wrapping (modular) subtraction
+ *
+ *  - lhs[i] = lhs[i] - rhs[i], wrapping around at the boundary of the type.
+ *
+ * @param[in,out] lhs The values to subtract from, receives the result
+ * @param[in] rhs The values to subtract, must be the same size as lhs
+ */
+template<typename Tag>
+constexpr void
+wrapping_sub(const std::span<integer<Tag>> lhs,
+             const std::type_identity_t<std::span<const integer<Tag>>> rhs) noexcept
+{
+    detail::bulk::transform(lhs, rhs,
+                            [](const auto a, const auto b)
+                            { return detail::bulk::wrapping_sub(a, b); });
+}
+
+/**
+ * @brief wrapping_mul - element-wise wrapping (modular) multiplication
+ *
+ *  - lhs[i] = lhs[i] * rhs[i], wrapping around at the boundary of the type.
+ *
+ * @param[in,out] lhs The values to multiply, receives the result
+ * @param[in] rhs The values to multiply by, must be the same size as lhs
+ */
+template<typename Tag>
+constexpr void
+wrapping_mul(const std::span<integer<Tag>> lhs,
+             const std::type_identity_t<std::span<const integer<Tag>>> rhs) noexcept
+{
+    detail::bulk::transform(lhs, rhs,
+                            [](const auto a, const auto b)
+                            { return detail::bulk::wrapping_mul(a, b); });
+}
+
+/**
+ * @brief saturating_add - element-wise saturating addition
+ *
+ *  - lhs[i] = lhs[i] + rhs[i], instead of overflowing will store a saturated value.
+ *
+ * @param[in,out] lhs The values to add to, receives the result
+ * @param[in] rhs The values to add, must be the same size as lhs
+ */
+template<typename Tag>
+constexpr void
+saturating_add(const std::span<integer<Tag>> lhs,
+               const std::type_identity_t<std::span<const integer<Tag>>> rhs) noexcept
+{
+    detail::bulk::transform(lhs, rhs,
+                            [](const auto a, const auto b)
+                            { return detail::bulk::saturating_add(a, b); });
+}
+
+/**
+ * @brief saturating_sub - element-wise saturating subtraction
+ *
+ *  - lhs[i] = lhs[i] - rhs[i], instead of overflowing will store a saturated value.
+ *
+ * @param[in,out] lhs The values to subtract from, receives the result
+ * @param[in] rhs The values to subtract, must be the same size as lhs
+ */
+template<typename Tag>
+constexpr void
+saturating_sub(const std::span<integer<Tag>> lhs,
+               const std::type_identity_t<std::span<const integer<Tag>>> rhs) noexcept
+{
+    detail::bulk::transform(lhs, rhs,
+                            [](const auto a, const auto b)
+                            { return detail::bulk::saturating_sub(a, b); });
+}
+
+/**
+ * @brief saturating_mul - element-wise saturating multiplication
+ *
+ *  - lhs[i] = lhs[i] * rhs[i], instead of overflowing will store a saturated value.
+ *
+ * @param[in,out] lhs The values to multiply, receives the result
+ * @param[in] rhs The values to multiply by, must be the same size as lhs
+ */
+template<typename Tag>
+constexpr void
+saturating_mul(const std::span<integer<Tag>> lhs,
+               const std::type_identity_t<std::span<const integer<Tag>>> rhs) noexcept
+{
+    detail::bulk::transform(lhs, rhs,
+                            [](const auto a, const auto b)
+                            { return detail::bulk::saturating_mul(a, b); });
+}
+
+/**
+ * @brief checked_add - element-wise checked addition
+ *
+ *  - lhs[i] = lhs[i] + rhs[i], stopping at the first overflow. Elements
+ *    before the overflowing index hold their result, the rest are unchanged.
+ *
+ * @param[in,out] lhs The values to add to, receives the result
+ * @param[in] rhs The values to add, must be the same size as lhs
+ *
+ * @return nothing, or the index of the first element that overflowed.
+ */
+template<typename Tag>
+[[nodiscard]] constexpr std::expected<void, std::size_t>
+checked_add(const std::span<integer<Tag>> lhs,
+            const std::type_identity_t<std::span<const integer<Tag>>> rhs) noexcept
+{
+    return detail::bulk::checked_transform(lhs, rhs,
+                                           [](const auto a, const auto b)
+                                           { return detail::bulk::overflowing_add(a, b); });
+}
+
+/**
+ * @brief checked_sub - element-wise checked subtraction
+ *
+ *  - lhs[i] = lhs[i] - rhs[i], stopping at the first overflow. Elements
+ *    before the overflowing index hold their result, the rest are unchanged.
+ *
+ * @param[in,out] lhs The values to subtract from, receives the result
+ * @param[in] rhs The values to subtract, must be the same size as lhs
+ *
+ * @return nothing, or the index of the first element that overflowed.
+ */
+template<typename Tag>
+[[nodiscard]] constexpr std::expected<void, std::size_t>
+checked_sub(const std::span<integer<Tag>> lhs,
+            const std::type_identity_t<std::span<const integer<Tag>>> rhs) noexcept
+{
+    return detail::bulk::checked_transform(lhs, rhs,
+                                           [](const auto a, const auto b)
+                                           { return detail::bulk::overflowing_sub(a, b); });
+}
+
+/**
+ * @brief checked_mul - element-wise checked multiplication
+ *
+ *  - lhs[i] = lhs[i] * rhs[i], stopping at the first overflow. Elements
+ *    before the overflowing index hold their result, the rest are unchanged.
+ *
+ * @param[in,out] lhs The values to multiply, receives the result
+ * @param[in] rhs The values to multiply by, must be the same size as lhs
+ *
+ * @return nothing, or the index of the first element that overflowed.
+ */
+template<typename Tag>
+[[nodiscard]] constexpr std::expected<void, std::size_t>
+checked_mul(const std::span<integer<Tag>> lhs,
+            const std::type_identity_t<std::span<const integer<Tag>>> rhs) noexcept
+{
+    return detail::bulk::checked_transform(lhs, rhs,
+                                           [](const auto a, const auto b)
+                                           { return detail::bulk::overflowing_mul(a, b); });
+}
+
+/**
+ * @brief unchecked_cast - element-wise truncating conversion
+ *
+ *  - dst[i] = src[i], keeping only the low bits when narrowing,
+ *    same as integer::unchecked_create().
+ *
+ * @param[out] dst The converted values
+ * @param[in] src The values to convert, must be the same size as dst
+ */
+template<typename To, typename From>
+constexpr void
+unchecked_cast(const std::span<integer<To>> dst, const std::span<const integer<From>> src) noexcept
+{
+    using to_type = typename integer<To>::integer_type;
+
+    ztd::panic_if(dst.size() != src.size(), "span sizes do not match");
+
+    const auto in = as_raw(src);
+    const auto out = as_raw(dst);
+    for (std::size_t i = 0; i < in.size(); ++i)
+    {
+        out[i] = static_cast<to_type>(in[i]);
+    }
+}
+
+/**
+ * @brief unchecked_cast - element-wise truncating conversion
+ *
+ *  - dst[i] = src[i], keeping only the low bits when narrowing,
+ *    same as integer::unchecked_create().
+ *
+ * @param[out] dst The converted values
+ * @param[in] src The values to convert, must be the same size as dst
+ */
+template<typename To, typename From>
+constexpr void
+unchecked_cast(const std::span<integer<To>> dst, const std::span<integer<From>> src) noexcept
+{
+    unchecked_cast(dst, std::span<const integer<From>>(src));
+}
+
+/**
+ * @brief saturating_cast - element-wise saturating conversion
+ *
+ *  - dst[i] = src[i], clamped to the range of the destination type,
+ *    same as integer::saturating_create(). The clamp is a branch-free
+ *    min/max, which vectorizes to a pack with saturation.
+ *
+ * @param[out] dst The converted values
+ * @param[in] src The values to convert, must be the same size as dst
+ */
+template<typename To, typename From>
+constexpr void
+saturating_cast(const std::span<integer<To>> dst, const std::span<const integer<From>> src) noexcept
+{
+    using to_type = typename integer<To>::integer_type;
+    using from_type = typename integer<From>::integer_type;
+
+    constexpr auto lo = detail::bulk::cast_min<to_type, from_type>;
+    constexpr auto hi = detail::bulk::cast_max<to_type, from_type>;
+
+    ztd::panic_if(dst.size() != src.size(), "span sizes do not match");
+
+    const auto in = as_raw(src);
+    const auto out = as_raw(dst);
+    for (std::size_t i = 0; i < in.size(); ++i)
+    {
+        out[i] = static_cast<to_type>(std::min(std::max(in[i], lo), hi));
+    }
+}
+
+/**
+ * @brief saturating_cast - element-wise saturating conversion
+ *
+ *  - dst[i] = src[i], clamped to the range of the destination type,
+ *    same as integer::saturating_create(). The clamp is a branch-free
+ *    min/max, which vectorizes to a pack with saturation.
+ *
+ * @param[out] dst The converted values
+ * @param[in] src The values to convert, must be the same size as dst
+ */
+template<typename To, typename From>
+constexpr void
+saturating_cast(const std::span<integer<To>> dst, const std::span<integer<From>> src) noexcept
+{
+    saturating_cast(dst, std::span<const integer<From>>(src));
+}
+
+/**
+ * @brief checked_cast - element-wise checked conversion
+ *
+ *  - dst[i] = src[i], stopping at the first value that does not fit in the
+ *    destination type. Elements before the failing index hold their result,
+ *    the rest are unchanged.
+ *
+ * @param[out] dst The converted values
+ * @param[in] src The values to convert, must be the same size as dst
+ *
+ * @return nothing, or the index of the first element that did not fit.
+ */
+template<typename To, typename From>
+[[nodiscard]] constexpr std::expected<void, std::size_t>
+checked_cast(const std::span<integer<To>> dst, const std::span<const integer<From>> src) noexcept
+{
+    using to_type = typename integer<To>::integer_type;
+    using from_type = typename integer<From>::integer_type;
+
+    constexpr auto lo = detail::bulk::cast_min<to_type, from_type>;
+    constexpr auto hi = detail::bulk::cast_max<to_type, from_type>;
+
+    ztd::panic_if(dst.size() != src.size(), "span sizes do not match");
+
+    const auto in = as_raw(src);
+    const auto out = as_raw(dst);
+    for (std::size_t base = 0; base < in.size(); base += detail::bulk::block_size)
+    {
+        const auto count = std::min(detail::bulk::block_size, in.size() - base);
+
+        // a plain or reduction of the range checks, so that it vectorizes.
+        from_type overflow = 0;
+        for (std::size_t i = base; i < base + count; ++i)
+        {
+            overflow |= from_type((in[i] < lo) | (in[i] > hi));
+        }
+
+        if (overflow != 0) [[unlikely]]
+        {
+            // slow path, commit everything before the first failure.
+            for (std::size_t i = base; i < base + count; ++i)
+            {
+                if (in[i] < lo || in[i] > hi)
+                {
+                    return std::unexpected(i);
+                }
+                out[i] = static_cast<to_type>(in[i]);
+            }
+        }
+
+        for (std::size_t i = base; i < base + count; ++i)
+        {
+            out[i] = static_cast<to_type>(in[i]);
+        }
+    }
+    return {};
+}
+
+/**
+ * @brief checked_cast - element-wise checked conversion
+ *
+ *  - dst[i] = src[i], stopping at the first value that does not fit in the
+ *    destination type. Elements before the failing index hold their result,
+ *    the rest are unchanged.
+ *
+ * @param[out] dst The converted values
+ * @param[in] src The values to convert, must be the same size as dst
+ *
+ * @return nothing, or the index of the first element that did not fit.
+ */
+template<typename To, typename From>
+[[nodiscard]] constexpr std::expected<void, std::size_t>
+checked_cast(const std::span<integer<To>> dst, const std::span<integer<From>> src) noexcept
+{
+    return checked_cast(dst, std::span<const integer<From>>(src));
+}
+
+/**
+ * @brief count_ones - population count over a bitmap
+ *
+ *  - The number of ones in the binary representation of every element,
+ *    same as summing integer::count_ones().
+ *
+ * @param[in] s The bitmap
+ *
+ * @return the total number of ones.
+ */
+template<typename Tag>
+[[nodiscard]] constexpr std::size_t
+count_ones(const std::span<const integer<Tag>> s) noexcept
+{
+    return detail::bulk::count_ones(as_raw(s));
+}
+
+/**
+ * @brief count_ones - population count over a bitmap
+ *
+ *  - The number of ones in the binary representation of every element,
+ *    same as summing integer::count_ones().
+ *
+ * @param[in] s The bitmap
+ *
+ * @return the total number of ones.
+ */
+template<typename Tag>
+[[nodiscard]] constexpr std::size_t
+count_ones(const std::span<integer<Tag>> s) noexcept
+{
+    return count_ones(std::span<const integer<Tag>>(s));
+}
+
+/**
+ * @brief find_first_set - first one bit in a bitmap
+ *
+ *  - Bit i of the bitmap is bit (i % BITS) of s[i / BITS], counting from
+ *    the least significant bit.
+ *
+ * @param[in] s The bitmap
+ *
+ * @return the index of the first one bit, or std::nullopt if there is none.
+ */
+template<typename Tag>
+[[nodiscard]] constexpr std::optional<std::size_t>
+find_first_set(const std::span<const integer<Tag>> s) noexcept
+{
+    return detail::bulk::find_next(as_raw(s), 0, true);
+}
+
+/**
+ * @brief find_first_set - first one bit in a bitmap
+ *
+ *  - Bit i of the bitmap is bit (i % BITS) of s[i / BITS], counting from
+ *    the least significant bit.
+ *
+ * @param[in] s The bitmap
+ *
+ * @return the index of the first one bit, or std::nullopt if there is none.
+ */
+template<typename Tag>
+[[nodiscard]] constexpr std::optional<std::size_t>
+find_first_set(const std::span<integer<Tag>> s) noexcept
+{
+    return find_first_set(std::span<const integer<Tag>>(s));
+}
+
+/**
+ * @brief find_next_set - next one bit in a bitmap
+ *
+ *  - Bit i of the bitmap is bit (i % BITS) of s[i / BITS], counting from
+ *    the least significant bit.
+ *
+ * @param[in] s The bitmap
+ * @param[in] from The first bit index to consider
+ *
+ * @return the index of the first one bit at or after from, or std::nullopt
+ * if there is none.
+ */
+template<typename Tag>
+[[nodiscard]] constexpr std::optional<std::size_t>
+find_next_set(const std::span<const integer<Tag>> s, const std::size_t from) noexcept
+{
+    return detail::bulk::find_next(as_raw(s), from, true);
+}
+
+/**
+ * @brief find_next_set - next one bit in a bitmap
+ *
+ *  - Bit i of the bitmap is bit (i % BITS) of s[i / BITS], counting from
+ *    the least significant bit.
+ *
+ * @param[in] s The bitmap
+ * @param[in] from The first bit index to consider
+ *
+ * @return the index of the first one bit at or after from, or std::nullopt
+ * if there is none.
+ */
+template<typename Tag>
+[[nodiscard]] constexpr std::optional<std::size_t>
+find_next_set(const std::span<integer<Tag>> s, const std::size_t from) noexcept
+{
+    return find_next_set(std::span<const integer<Tag>>(s), from);
+}
+
+/**
+ * @brief find_first_unset - first zero bit in a bitmap
+ *
+ *  - Bit i of the bitmap is bit (i % BITS) of s[i / BITS], counting from
+ *    the least significant bit.
+ *
+ * @param[in] s The bitmap
+ *
+ * @return the index of the first zero bit, or std::nullopt if there is none.
+ */
+template<typename Tag>
+[[nodiscard]] constexpr std::optional<std::size_t>
+find_first_unset(const std::span<const integer<Tag>> s) noexcept
+{
+    return detail::bulk::find_next(as_raw(s), 0, false);
+}
+
+/**
+ * @brief find_first_unset - first zero bit in a bitmap
+ *
+ *  - Bit i of the bitmap is bit (i % BITS) of s[i / BITS], counting from
+ *    the least significant bit.
+ *
+ * @param[in] s The bitmap
+ *
+ * @return the index of the first zero bit, or std::nullopt if there is none.
+ */
+template<typename Tag>
+[[nodiscard]] constexpr std::optional<std::size_t>
+find_first_unset(const std::span<integer<Tag>> s) noexcept
+{
+    return find_first_unset(std::span<const integer<Tag>>(s));
+}
+
+/**
+ * @brief find_next_unset - next zero bit in a bitmap
+ *
+ *  - Bit i of the bitmap is bit (i % BITS) of s[i / BITS], counting from
+ *    the least significant bit.
+ *
+ * @param[in] s The bitmap
+ * @param[in] from The first bit index to consider
+ *
+ * @return the index of the first zero bit at or after from, or std::nullopt
+ * if there is none.
+ */
+template<typename Tag>
+[[nodiscard]] constexpr std::optional<std::size_t>
+find_next_unset(const std::span<const integer<Tag>> s, const std::size_t from) noexcept
+{
+    return detail::bulk::find_next(as_raw(s), from, false);
+}
+
+/**
+ * @brief find_next_unset - next zero bit in a bitmap
+ *
+ *  - Bit i of the bitmap is bit (i % BITS) of s[i / BITS], counting from
+ *    the least significant bit.
+ *
+ * @param[in] s The bitmap
+ * @param[in] from The first bit index to consider
+ *
+ * @return the index of the first zero bit at or after from, or std::nullopt
+ * if there is none.
+ */
+template<typename Tag>
+[[nodiscard]] constexpr std::optional<std::size_t>
+find_next_unset(const std::span<integer<Tag>> s, const std::size_t from) noexcept
+{
+    return find_next_unset(std::span<const integer<Tag>>(s), from);
+}
+
+/**
+ * @brief swap_bytes - element-wise byte swap
+ *
+ *  - s[i] = s[i].swap_bytes(), i.e. to convert a network order buffer to
+ *    host order in place.
+ *
+ * @param[in,out] s The values to swap
+ */
+template<typename Tag>
+constexpr void
+swap_bytes(const std::span<integer<Tag>> s) noexcept
+{
+    for (auto& value : as_raw(s))
+    {
+        value = std::byteswap(value);
+    }
+}
+
+/**
+ * @brief rotate_left - element-wise rotate left
+ *
+ *  - s[i] = s[i].rotate_left(n), the bits shifted to the left by n, wrapping
+ *    the truncated bits to the other end.
+ *
+ * @param[in,out] s The values to rotate
+ * @param[in] n The number of bits to rotate by
+ */
+template<typename Tag>
+constexpr void
+rotate_left(const std::span<integer<Tag>> s, const integer<detail::i32> n) noexcept
+{
+    using integer_type = typename integer<Tag>::integer_type;
+    using unsigned_type = std::make_unsigned_t<integer_type>;
+
+    // n mod BITS, so that the shift is the same for every element.
+    const auto shift =
+        int(unsigned(n.data()) % unsigned(std::numeric_limits<unsigned_type>::digits));
+    for (auto& value : as_raw(s))
+    {
+        value = static_cast<integer_type>(std::rotl(static_cast<unsigned_type>(value), shift));
+    }
+}
+
+/**
+ * @brief rotate_right - element-wise rotate right
+ *
+ *  - s[i] = s[i].rotate_right(n), the bits shifted to the right by n, wrapping
+ *    the truncated bits to the other end.
+ *
+ * @param[in,out] s The values to rotate
+ * @param[in] n The number of bits to rotate by
+ */
+template<typename Tag>
+constexpr void
+rotate_right(const std::span<integer<Tag>> s, const integer<detail::i32> n) noexcept
+{
+    using integer_type = typename integer<Tag>::integer_type;
+    using unsigned_type = std::make_unsigned_t<integer_type>;
+
+    // n mod BITS, so that the shift is the same for every element.
+    const auto shift =
+        int(unsigned(n.data()) % unsigned(std::numeric_limits<unsigned_type>::digits));
+    for (auto& value : as_raw(s))
+    {
+        value = static_cast<integer_type>(std::rotr(static_cast<unsigned_type>(value), shift));
+    }
+}
+
+/**
+ * @brief fill_random - fill with uniform random values
+ *
+ *  - s[i] = a uniform random value between (min, max), drawn from engine.
+ *    Draws are never wasted on narrow types, and the bounded case is
+ *    division free.
+ *
+ * @param[out] s The values to fill
+ * @param[in] min min random value
+ * @param[in] max max random value
+ * @param[in,out] engine The engine to draw from, i.e. a seeded ztd::xoshiro256pp
+ */
+template<typename Tag, typename Engine>
+inline void
+fill_random(const std::span<integer<Tag>> s,
+            const integer<Tag> min,
+            const integer<Tag> max,
+            Engine& engine) noexcept
+    requires(detail::prng::is_engine64<Engine>)
+{
+    using integer_type = typename integer<Tag>::integer_type;
+    using unsigned_type = std::make_unsigned_t<integer_type>;
+
+    ztd::panic_if(min > max);
+
+    const auto range = std::uint64_t(unsigned_type(static_cast<unsigned_type>(max.data()) -
+                                                   static_cast<unsigned_type>(min.data())));
+    if (range == std::uint64_t(std::numeric_limits<unsigned_type>::max()))
+    {
+        detail::bulk::fill_random_bits(as_raw(s), engine);
+    }
+    else
+    {
+        detail::bulk::fill_random_bounded(as_raw(s), min.data(), range + 1, engine);
+    }
+}
+
+/**
+ * @brief fill_random - fill with uniform random values
+ *
+ *  - s[i] = a uniform random value between (MIN, MAX), drawn from engine.
+ *
+ * @param[out] s The values to fill
+ * @param[in,out] engine The engine to draw from, i.e. a seeded ztd::xoshiro256pp
+ */
+template<typename Tag, typename Engine>
+inline void
+fill_random(const std::span<integer<Tag>> s, Engine& engine) noexcept
+    requires(detail::prng::is_engine64<Engine>)
+{
+    detail::bulk::fill_random_bits(as_raw(s), engine);
+}
+
+/**
+ * @brief fill_random - fill with uniform random values
+ *
+ *  - s[i] = a uniform random value between (min, max), the bulk form of
+ *    integer<Tag>::random(min, max).
+ *
+ * @param[out] s The values to fill
+ * @param[in] min min random value
+ * @param[in] max max random value
+ */
+template<typename Tag>
+inline void
+fill_random(const std::span<integer<Tag>> s,
+            const integer<Tag> min,
+            const integer<Tag> max) noexcept
+{
+    fill_random(s, min, max, detail::rng());
+}
+
+/**
+ * @brief fill_random - fill with uniform random values
+ *
+ *  - s[i] = a uniform random value between (MIN, MAX), the bulk form of
+ *    integer<Tag>::random().
+ *
+ * @param[out] s The values to fill
+ */
+template<typename Tag>
+inline void
+fill_random(const std::span<integer<Tag>> s) noexcept
+{
+    fill_random(s, detail::rng());
+}
+} // namespace ztd
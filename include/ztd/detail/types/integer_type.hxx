@@ -46,6 +46,7 @@ struct sign_conversion_disabled{};
 // Math modes
 struct math_strict{};
 struct math_overflow{};
+struct math_saturating{};
 // clang-format on
 
 #if ZTD_DEFAULT_MATH_MODE == 1
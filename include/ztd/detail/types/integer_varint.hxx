@@ -0,0 +1,418 @@
+/**
+ * Copyright (C) 2025 Brandon Zorn <brandonzorn@cock.li>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <expected>
+#include <limits>
+#include <span>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+#include "integer.hxx"
+
+// LEB128 variable-length integers.
+//
+// Each byte holds 7 bits of the value, least significant group first, and the
+// high bit of a byte is set if another byte follows. Unsigned values are
+// encoded as is, signed values are zigzag encoded first so that small
+// negative values are short as well.
+//
+//   0   -> 00
+//   300 -> ac 02
+//   -1  -> 01 (zigzag)
+
+namespace ztd
+{
+/**
+ * @brief zigzag_encode
+ *
+ *  - Map a signed integer onto an unsigned integer so that values close to
+ *    zero are small, 0 -> 0, -1 -> 1, 1 -> 2, -2 -> 3, ...
+ */
+template<typename Tag>
+[[nodiscard]] constexpr integer<typename integer<Tag>::sign_conversion>
+zigzag_encode(const integer<Tag> value) noexcept
+    requires(detail::is_signed_integer<typename integer<Tag>::integer_type>)
+{
+    using integer_type = typename integer<Tag>::integer_type;
+    using unsigned_type = std::make_unsigned_t<integer_type>;
+
+    constexpr auto bits = std::numeric_limits<unsigned_type>::digits;
+
+    const auto v = value.data();
+    return integer<typename integer<Tag>::sign_conversion>(static_cast<unsigned_type>(
+        static_cast<unsigned_type>(static_cast<unsigned_type>(v) << 1) ^
+        static_cast<unsigned_type>(v >> (bits - 1))));
+}
+
+/**
+ * @brief zigzag_decode
+ *
+ *  - The inverse of zigzag_encode().
+ */
+template<typename Tag>
+[[nodiscard]] constexpr integer<typename integer<Tag>::sign_conversion>
+zigzag_decode(const integer<Tag> value) noexcept
+    requires(detail::is_unsigned_integer<typename integer<Tag>::integer_type>)
+{
+    using integer_type = typename integer<Tag>::integer_type;
+    using signed_type = std::make_signed_t<integer_type>;
+
+    const auto v = value.data();
+    return integer<typename integer<Tag>::sign_conversion>(static_cast<signed_type>(
+        static_cast<integer_type>(v >> 1) ^ static_cast<integer_type>(-(v & 1u))));
+}
+
+/**
+ * @brief varint_max_bytes
+ *
+ *  - The longest encoding of any value of Integer.
+ */
+template<typename Integer>
+inline constexpr std::size_t varint_max_bytes =
+    (std::numeric_limits<std::make_unsigned_t<typename Integer::integer_type>>::digits + 6) / 7;
+
+struct to_varint_result final
+{
+    std::byte* ptr;
+    std::errc ec;
+
+    friend bool operator==(const to_varint_result&, const to_varint_result&) = default;
+};
+
+struct from_varint_result final
+{
+    const std::byte* ptr;
+    std::errc ec;
+
+    friend bool operator==(const from_varint_result&, const from_varint_result&) = default;
+};
+
+namespace detail::varint
+{
+template<typename Tag>
+using unsigned_t = std::make_unsigned_t<typename integer<Tag>::integer_type>;
+
+template<typename Tag>
+[[nodiscard]] constexpr unsigned_t<Tag>
+to_unsigned(const integer<Tag> value) noexcept
+{
+    if constexpr (detail::is_signed_integer<typename integer<Tag>::integer_type>)
+    {
+        return zigzag_encode(value).data();
+    }
+    else
+    {
+        return value.data();
+    }
+}
+
+template<typename Tag>
+[[nodiscard]] constexpr integer<Tag>
+from_unsigned(const unsigned_t<Tag> value) noexcept
+{
+    if constexpr (detail::is_signed_integer<typename integer<Tag>::integer_type>)
+    {
+        return zigzag_decode(integer<typename integer<Tag>::sign_conversion>(value));
+    }
+    else
+    {
+        return integer<Tag>(value);
+    }
+}
+
+// Values below this fit in 8 encoded bytes, which is what the word at a time
+// paths handle.
+inline constexpr std::uint64_t word_limit = std::uint64_t(1) << 56;
+
+[[nodiscard]] inline std::uint64_t
+load(const std::byte* const ptr) noexcept
+{
+    std::uint64_t word;
+    std::memcpy(&word, ptr, sizeof(word));
+    if constexpr (std::endian::native == std::endian::big)
+    {
+        word = std::byteswap(word);
+    }
+    return word;
+}
+
+inline void
+store(std::byte* const ptr, std::uint64_t word) noexcept
+{
+    if constexpr (std::endian::native == std::endian::big)
+    {
+        word = std::byteswap(word);
+    }
+    std::memcpy(ptr, &word, sizeof(word));
+}
+
+// Spread the low 56 bits of value into 7 bit groups, one per byte, and set
+// the continuation bit on all but the last of the length bytes.
+[[nodiscard]] constexpr std::uint64_t
+spread(std::uint64_t value, const std::size_t length) noexcept
+{
+    value = (value & 0x0000'0000'0fff'ffff) | ((value << 4) & 0x0fff'ffff'0000'0000);
+    value = (value & 0x0000'3fff'0000'3fff) | ((value << 2) & 0x3fff'0000'3fff'0000);
+    value = (value & 0x007f'007f'007f'007f) | ((value << 1) & 0x7f00'7f00'7f00'7f00);
+    return value | (0x8080'8080'8080'8080 & ((std::uint64_t(1) << (8 * (length - 1))) - 1));
+}
+
+// The inverse of spread(), word holds the length bytes of an encoding.
+[[nodiscard]] constexpr std::uint64_t
+compact(std::uint64_t word) noexcept
+{
+    word &= 0x7f7f'7f7f'7f7f'7f7f;
+    word = (word & 0x007f'007f'007f'007f) | ((word & 0x7f00'7f00'7f00'7f00) >> 1);
+    word = (word & 0x0000'3fff'0000'3fff) | ((word & 0x3fff'0000'3fff'0000) >> 2);
+    return (word & 0x0000'0000'0fff'ffff) | ((word & 0x0fff'ffff'0000'0000) >> 4);
+}
+
+[[nodiscard]] constexpr std::size_t
+encoded_size(const std::uint64_t value) noexcept
+{
+    // bit_width(0) is 0, but 0 still takes one byte
+    return std::size_t(std::bit_width(value | 1) + 6) / 7;
+}
+
+// Decode one value of at most max_bytes, byte at a time.
+template<typename U>
+[[nodiscard]] constexpr from_varint_result
+decode(const std::byte* first, const std::byte* const last, U& value) noexcept
+{
+    constexpr auto bits = std::numeric_limits<U>::digits;
+    constexpr auto max_bytes = std::size_t(bits + 6) / 7;
+
+    U result = 0;
+    for (std::size_t i = 0; i < max_bytes; ++i)
+    {
+        if (first + i == last)
+        {
+            return {first, std::errc::invalid_argument};
+        }
+
+        const auto byte = std::to_integer<unsigned>(first[i]);
+        const auto group = byte & 0x7fu;
+        const auto shift = int(7 * i);
+        if (i == max_bytes - 1 && (group >> (bits - shift)) != 0)
+        {
+            // the last group has bits that do not fit
+            return {first, std::errc::result_out_of_range};
+        }
+        result |= static_cast<U>(static_cast<U>(group) << shift);
+
+        if ((byte & 0x80u) == 0)
+        {
+            value = result;
+            return {first + i + 1, std::errc()};
+        }
+    }
+    return {first, std::errc::result_out_of_range};
+}
+} // namespace detail::varint
+
+/**
+ * @brief to_varint
+ *
+ *  - Write the LEB128 encoding of value into [first, last). Signed values
+ *    are zigzag encoded. At most varint_max_bytes<integer<Tag>> are written.
+ *
+ * @param[in] first The start of the output buffer
+ * @param[in] last The end of the output buffer
+ * @param[in] value The integer to write
+ *
+ * @return one past the last byte written, or std::errc::value_too_large if
+ * the buffer is too small.
+ */
+template<typename Tag>
+[[nodiscard]] constexpr to_varint_result
+to_varint(std::byte* const first, std::byte* const last, const integer<Tag> value) noexcept
+{
+    auto v = detail::varint::to_unsigned(value);
+
+    const auto length = detail::varint::encoded_size(std::uint64_t(v));
+    if (std::size_t(last - first) < length)
+    {
+        return {last, std::errc::value_too_large};
+    }
+
+    for (std::size_t i = 0; i < length - 1; ++i)
+    {
+        first[i] = std::byte((v & 0x7fu) | 0x80u);
+        v = static_cast<decltype(v)>(v >> 7);
+    }
+    first[length - 1] = std::byte(v);
+    return {first + length, std::errc()};
+}
+
+/**
+ * @brief from_varint
+ *
+ *  - Read a LEB128 encoded value from [first, last). The value has to fit in
+ *    integer<Tag> the same way as for integer::checked_create().
+ *
+ * @param[in] first The start of the input
+ * @param[in] last The end of the input
+ * @param[out] value The decoded integer, unchanged on error
+ *
+ * @return one past the last byte read, std::errc::invalid_argument if the
+ * input ends before the value does, or std::errc::result_out_of_range if the
+ * value does not fit.
+ */
+template<typename Tag>
+[[nodiscard]] constexpr from_varint_result
+from_varint(const std::byte* const first,
+            const std::byte* const last,
+            integer<Tag>& value) noexcept
+{
+    detail::varint::unsigned_t<Tag> result{};
+    const auto r = detail::varint::decode(first, last, result);
+    if (r.ec == std::errc())
+    {
+        value = detail::varint::from_unsigned<Tag>(result);
+    }
+    return r;
+}
+
+/**
+ * @brief encode_varints
+ *
+ *  - LEB128 encode a sequence of integers back to back.
+ *
+ *  - Values that fit in 8 encoded bytes are spread into 7 bit groups with
+ *    a few shifts and masks and written as a single word, instead of a byte
+ *    at a time.
+ *
+ * @param[in] values The integers to encode
+ *
+ * @return the encoded bytes
+ */
+template<typename Tag>
+[[nodiscard]] inline std::vector<std::byte>
+encode_varints(const std::span<const integer<Tag>> values)
+{
+    constexpr auto max_bytes = varint_max_bytes<integer<Tag>>;
+
+    // room for a full word store past the last value
+    std::vector<std::byte> result(values.size() * max_bytes + sizeof(std::uint64_t));
+
+    std::byte* ptr = result.data();
+    for (const auto value : values)
+    {
+        const auto v = std::uint64_t(detail::varint::to_unsigned(value));
+        if (v < detail::varint::word_limit) [[likely]]
+        {
+            const auto length = detail::varint::encoded_size(v);
+            detail::varint::store(ptr, detail::varint::spread(v, length));
+            ptr += length;
+        }
+        else
+        {
+            ptr = to_varint(ptr, result.data() + result.size(), value).ptr;
+        }
+    }
+    result.resize(static_cast<std::size_t>(ptr - result.data()));
+    return result;
+}
+
+/**
+ * @brief encode_varints
+ *
+ *  - LEB128 encode a sequence of integers back to back.
+ *
+ * @param[in] values The integers to encode
+ *
+ * @return the encoded bytes
+ */
+template<typename Tag>
+[[nodiscard]] inline std::vector<std::byte>
+encode_varints(const std::span<integer<Tag>> values)
+{
+    return encode_varints(std::span<const integer<Tag>>(values));
+}
+
+/**
+ * @brief decode_varints
+ *
+ *  - Decode back to back LEB128 values until the end of the input.
+ *
+ *  - While at least a word of input is left, the end of the next value is
+ *    found with a single mask and count of trailing zeros over 8 bytes, in
+ *    the style of Masked VByte, and its groups are compacted with shifts
+ *    and masks instead of a loop over the bytes.
+ *
+ * @param[in] bytes The encoded values
+ *
+ * @return the decoded integers, or the index of the first value that is
+ * truncated or does not fit in Integer.
+ */
+template<typename Integer>
+[[nodiscard]] inline std::expected<std::vector<Integer>, std::size_t>
+decode_varints(const std::span<const std::byte> bytes)
+{
+    using tag = typename Integer::tag;
+    using unsigned_type = detail::varint::unsigned_t<tag>;
+
+    constexpr auto bits = std::numeric_limits<unsigned_type>::digits;
+    constexpr auto max_bytes = varint_max_bytes<Integer>;
+
+    std::vector<Integer> result;
+    // a decent guess, most values are small
+    result.reserve(bytes.size());
+
+    const std::byte* ptr = bytes.data();
+    const std::byte* const last = bytes.data() + bytes.size();
+    while (ptr != last)
+    {
+        if (last - ptr >= std::ptrdiff_t(sizeof(std::uint64_t)))
+        {
+            const auto word = detail::varint::load(ptr);
+            const auto stop = ~word & 0x8080'8080'8080'8080;
+            if (stop != 0) [[likely]]
+            {
+                const auto length = std::size_t(std::countr_zero(stop) / 8 + 1);
+                const auto mask = length == 8 ? ~std::uint64_t(0)
+                                              : (std::uint64_t(1) << (8 * length)) - 1;
+                const auto value = detail::varint::compact(word & mask);
+                if (length > max_bytes || (bits < 64 && (value >> (bits % 64)) != 0))
+                {
+                    return std::unexpected(result.size());
+                }
+                result.push_back(detail::varint::from_unsigned<tag>(unsigned_type(value)));
+                ptr += length;
+                continue;
+            }
+        }
+
+        unsigned_type value{};
+        const auto r = detail::varint::decode(ptr, last, value);
+        if (r.ec != std::errc())
+        {
+            return std::unexpected(result.size());
+        }
+        result.push_back(detail::varint::from_unsigned<tag>(value));
+        ptr = r.ptr;
+    }
+    return result;
+}
+} // namespace ztd
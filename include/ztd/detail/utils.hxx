@@ -24,6 +24,7 @@
 
 #include <cmath>
 
+#include "charconv.hxx"
 #include "concepts.hxx"
 
 namespace ztd
@@ -44,13 +45,26 @@ template<typename T>
 from_string(const std::string_view str) noexcept
     requires(detail::is_integer<T> || std::is_floating_point_v<T>)
 {
+    const char* first = str.data();
+    const char* last = str.data() + str.size();
+
     T result{};
-    const auto [ptr, ec] = std::from_chars(str.data(), str.data() + str.size(), result);
+    const auto [ptr, ec] = [&]
+    {
+        if constexpr (detail::is_integer<T>)
+        {
+            return detail::charconv::from_chars(first, last, result);
+        }
+        else
+        {
+            return std::from_chars(first, last, result);
+        }
+    }();
     if (ec != std::errc())
     {
         return std::unexpected(std::make_error_code(ec));
     }
-    if (ptr != str.data() + str.size())
+    if (ptr != last)
     {
         return std::unexpected(std::make_error_code(std::errc::invalid_argument));
     }
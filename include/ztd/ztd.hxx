@@ -19,9 +19,12 @@
 
 #include "./detail/byte_size.hxx"
 #include "./detail/fuse.hxx"
+#include "./detail/hash.hxx"
 #include "./detail/map.hxx"
 #include "./detail/panic.hxx"
 #include "./detail/random.hxx"
+#include "./detail/random_distribution.hxx"
+#include "./detail/secure_random.hxx"
 #include "./detail/smart_cache.hxx"
 #include "./detail/string_python.hxx"
 #include "./detail/string_random.hxx"
@@ -0,0 +1,71 @@
+/**
+ * Copyright (C) 2025 Brandon Zorn <brandonzorn@cock.li>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include <doctest/doctest.h>
+
+#include "ztd/detail/hash.hxx"
+
+TEST_SUITE("ztd::string_hash" * doctest::description(""))
+{
+    TEST_CASE("hash")
+    {
+        const ztd::string_hash hash;
+        const auto expected = std::hash<std::string_view>{}("/usr/bin");
+
+        CHECK_EQ(hash(std::string_view("/usr/bin")), expected);
+        CHECK_EQ(hash(std::string("/usr/bin")), expected);
+        CHECK_EQ(hash("/usr/bin"), expected);
+        CHECK_EQ(hash(std::filesystem::path("/usr/bin")), expected);
+    }
+
+    TEST_CASE("equal")
+    {
+        const ztd::string_equal equal;
+
+        CHECK(equal(std::string("a"), std::string_view("a")));
+        CHECK(equal("a", std::filesystem::path("a")));
+        CHECK(equal(std::filesystem::path("a/b"), std::filesystem::path("a/b")));
+        CHECK_FALSE(equal(std::filesystem::path("a//b"), "a/b"));
+        CHECK_FALSE(equal(std::string_view("a"), "b"));
+    }
+
+    TEST_CASE("unordered_map")
+    {
+        std::unordered_map<std::string, int, ztd::string_hash, ztd::string_equal> strings{
+            {"one", 1},
+            {"two", 2},
+        };
+        CHECK_EQ(strings.find(std::string_view("one"))->second, 1);
+        CHECK_EQ(strings.find("two")->second, 2);
+        CHECK(strings.contains(std::filesystem::path("two")));
+        CHECK_FALSE(strings.contains(std::string_view("three")));
+
+        std::unordered_map<std::filesystem::path, int, ztd::string_hash, ztd::string_equal> paths{
+            {"/usr/bin", 1},
+            {"/usr/lib", 2},
+        };
+        CHECK_EQ(paths.find(std::string_view("/usr/bin"))->second, 1);
+        CHECK_EQ(paths.find("/usr/lib")->second, 2);
+        CHECK(paths.contains(std::string("/usr/lib")));
+        CHECK_FALSE(paths.contains("/usr"));
+    }
+}
@@ -15,7 +15,12 @@
  * along with this program. If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <random>
 #include <ranges>
+#include <set>
 
 #include <doctest/doctest.h>
 
@@ -76,6 +81,24 @@ TEST_SUITE("ztd::random" * doctest::description(""))
             }
         }
 
+        SUBCASE("narrow types")
+        {
+            std::set<std::int8_t> seen;
+            for (auto _ : std::views::iota(0, 10'000))
+            {
+                const auto value = ztd::random<std::int8_t>(-3, 3);
+                CHECK(value >= -3);
+                CHECK(value <= 3);
+                seen.insert(value);
+            }
+            CHECK_EQ(seen.size(), 7);
+
+            for (auto _ : std::views::iota(0, 100))
+            {
+                CHECK(ztd::random<std::uint8_t>(250, 255) >= 250);
+            }
+        }
+
         SUBCASE("floating point")
         {
             const auto min = 0;
@@ -110,4 +133,177 @@ TEST_SUITE("ztd::random" * doctest::description(""))
             CHECK(count_false > 0);
         }
     }
+
+    TEST_CASE_TEMPLATE("engines ", Engine, ztd::xoshiro256pp, ztd::wyrand, ztd::pcg64)
+    {
+        static_assert(std::uniform_random_bit_generator<Engine>);
+        static_assert(Engine::min() == 0);
+        static_assert(Engine::max() == std::numeric_limits<std::uint64_t>::max());
+
+        SUBCASE("seed")
+        {
+            Engine a(42);
+            Engine b(42);
+            Engine c(43);
+            CHECK(a == b);
+            CHECK(a != c);
+
+            for (auto _ : std::views::iota(0, 100))
+            {
+                CHECK_EQ(a(), b());
+            }
+            CHECK_NE(a(), c());
+
+            a.seed(7);
+            b = Engine(7);
+            CHECK(a == b);
+            CHECK_EQ(Engine(), Engine(Engine::default_seed));
+        }
+
+        SUBCASE("discard")
+        {
+            Engine a(1);
+            Engine b(1);
+            for (auto _ : std::views::iota(0, 1000))
+            {
+                (void)a();
+            }
+            b.discard(1000);
+            CHECK(a == b);
+            CHECK_EQ(a(), b());
+        }
+
+        SUBCASE("bits")
+        {
+            // every bit is set about half of the time
+            Engine engine(3);
+            std::array<std::int32_t, 64> ones{};
+            for (auto _ : std::views::iota(0, 10'000))
+            {
+                const auto value = engine();
+                for (std::size_t bit = 0; bit < 64; ++bit)
+                {
+                    ones[bit] += std::int32_t((value >> bit) & 1);
+                }
+            }
+            for (const auto count : ones)
+            {
+                CHECK(count > 4'500);
+                CHECK(count < 5'500);
+            }
+        }
+
+        SUBCASE("distributions")
+        {
+            Engine engine(5);
+            std::uniform_int_distribution<std::int32_t> dist(1, 6);
+            for (auto _ : std::views::iota(0, 100))
+            {
+                const auto value = dist(engine);
+                CHECK(value >= 1);
+                CHECK(value <= 6);
+            }
+        }
+    }
+
+    TEST_CASE("pcg64 streams")
+    {
+        ztd::pcg64 a(1, 1);
+        ztd::pcg64 b(1, 2);
+        CHECK(a != b);
+        CHECK_NE(a(), b());
+    }
+
+    TEST_CASE("xoshiro256pp jump")
+    {
+        ztd::xoshiro256pp a(1);
+        ztd::xoshiro256pp b(1);
+        a.jump();
+        CHECK(a != b);
+        b.jump();
+        CHECK(a == b);
+
+        b.long_jump();
+        CHECK(a != b);
+    }
+
+    TEST_CASE_TEMPLATE("random_context ",
+                       Engine,
+                       ztd::xoshiro256pp,
+                       ztd::wyrand,
+                       ztd::pcg64,
+                       std::mt19937_64)
+    {
+        SUBCASE("reproducible")
+        {
+            ztd::random_context<Engine> a(42);
+            ztd::random_context<Engine> b(42);
+            CHECK_EQ(a.seed(), 42);
+            CHECK_EQ(a.stream_index(), 0);
+
+            for (auto _ : std::views::iota(0, 100))
+            {
+                CHECK_EQ(ztd::random<std::int32_t>(a, -5, 5), ztd::random<std::int32_t>(b, -5, 5));
+                CHECK_EQ(ztd::random<std::uint64_t>(a), ztd::random<std::uint64_t>(b));
+                CHECK_EQ(ztd::random<double>(a, 0.0, 1.0), ztd::random<double>(b, 0.0, 1.0));
+                CHECK_EQ(ztd::random<bool>(a), ztd::random<bool>(b));
+            }
+        }
+
+        SUBCASE("range")
+        {
+            ztd::random_context<Engine> context(7);
+            for (auto _ : std::views::iota(0, 100))
+            {
+                const auto value = ztd::random<std::int8_t>(context, -3, 3);
+                CHECK(value >= -3);
+                CHECK(value <= 3);
+
+                const auto real = ztd::random<float>(context, 1.0f, 2.0f);
+                CHECK(real >= 1.0f);
+                CHECK(real <= 2.0f);
+            }
+        }
+
+        SUBCASE("streams")
+        {
+            const ztd::random_context<Engine> base(42);
+
+            // the same stream of the same seed is the same
+            auto a = base.stream(3);
+            auto b = ztd::random_context<Engine>(42).stream(3);
+            CHECK_EQ(a.stream_index(), 3);
+            CHECK_EQ(a(), b());
+
+            // and distinct streams are not
+            std::set<std::uint64_t> first;
+            for (std::uint64_t i = 0; i < 16; ++i)
+            {
+                first.insert(base.stream(i)());
+            }
+            CHECK_EQ(first.size(), 16);
+
+            // stream 0 is the seed itself
+            auto zero = base.stream(0);
+            auto seeded = ztd::random_context<Engine>(42);
+            CHECK_EQ(zero(), seeded());
+        }
+    }
+
+    TEST_CASE("random_context xoshiro256pp streams")
+    {
+        ztd::xoshiro256pp engine(9);
+        engine.jump();
+        engine.jump();
+
+        auto context = ztd::random_context(9).stream(2);
+        CHECK(context.engine() == engine);
+    }
+
+    TEST_CASE("random_context unseeded")
+    {
+        ztd::random_context a;
+        ztd::random_context b;
+        CHECK_NE(a.seed(), b.seed());
+    }
 }
@@ -0,0 +1,164 @@
+/**
+ * Copyright (C) 2025 Brandon Zorn <brandonzorn@cock.li>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "ztd/detail/random_distribution.hxx"
+
+namespace
+{
+template<typename T>
+double
+mean(const std::vector<T>& values)
+{
+    double sum = 0.0;
+    for (const auto value : values)
+    {
+        sum += double(value);
+    }
+    return sum / double(values.size());
+}
+
+template<typename T>
+double
+variance(const std::vector<T>& values)
+{
+    const auto m = mean(values);
+    double sum = 0.0;
+    for (const auto value : values)
+    {
+        sum += (double(value) - m) * (double(value) - m);
+    }
+    return sum / double(values.size());
+}
+
+template<typename T, typename Predicate>
+double
+fraction(const std::vector<T>& values, Predicate predicate)
+{
+    return double(std::ranges::count_if(values, predicate)) / double(values.size());
+}
+} // namespace
+
+TEST_SUITE("ztd::random" * doctest::description(""))
+{
+    TEST_CASE_TEMPLATE("fill_random ", T, float, double)
+    {
+        SUBCASE("range")
+        {
+            // every length around a whole block
+            for (const std::size_t size : {0uz, 1uz, 2uz, 3uz, 255uz, 256uz, 257uz, 513uz})
+            {
+                std::vector<T> values(size, T(-1));
+                ztd::fill_random(std::span(values), T(2), T(5));
+                CHECK(std::ranges::all_of(values, [](const T v) { return v >= T(2) && v < T(5); }));
+            }
+        }
+
+        SUBCASE("uniform")
+        {
+            std::vector<T> values(100'000);
+            ztd::fill_random(std::span(values));
+            CHECK(std::ranges::all_of(values, [](const T v) { return v >= T(0) && v < T(1); }));
+            CHECK(std::abs(mean(values) - 0.5) < 0.01);
+            CHECK(std::abs(variance(values) - 1.0 / 12.0) < 0.01);
+            CHECK(std::abs(fraction(values, [](const T v) { return v < T(0.1); }) - 0.1) < 0.01);
+        }
+
+        SUBCASE("seeded")
+        {
+            std::vector<T> a(1'001);
+            std::vector<T> b(1'001);
+            ztd::random_context ca(4);
+            ztd::random_context cb(4);
+            ztd::fill_random(std::span(a), T(0), T(10), ca);
+            ztd::fill_random(std::span(b), T(0), T(10), cb);
+            CHECK_EQ(a, b);
+        }
+    }
+
+    TEST_CASE_TEMPLATE("fill_normal ", T, float, double)
+    {
+        std::vector<T> values(200'000);
+        ztd::random_context context(1);
+        ztd::fill_normal(std::span(values), T(0), T(1), context);
+
+        CHECK(std::abs(mean(values)) < 0.01);
+        CHECK(std::abs(variance(values) - 1.0) < 0.02);
+        CHECK(std::ranges::all_of(values, [](const T v) { return std::isfinite(v); }));
+
+        // the tails, including past the base layer at R = 3.65
+        CHECK(std::abs(fraction(values, [](const T v) { return v > T(1); }) - 0.1587) < 0.005);
+        CHECK(std::abs(fraction(values, [](const T v) { return v < T(-2); }) - 0.02275) < 0.002);
+        CHECK(fraction(values, [](const T v) { return std::abs(v) > T(3.7); }) > 0.0);
+        CHECK(fraction(values, [](const T v) { return std::abs(v) > T(3.7); }) < 0.001);
+
+        ztd::fill_normal(std::span(values), T(10), T(3));
+        CHECK(std::abs(mean(values) - 10.0) < 0.05);
+        CHECK(std::abs(variance(values) - 9.0) < 0.2);
+    }
+
+    TEST_CASE_TEMPLATE("fill_exponential ", T, float, double)
+    {
+        std::vector<T> values(200'000);
+        ztd::random_context context(2);
+        ztd::fill_exponential(std::span(values), T(1), context);
+
+        CHECK(std::ranges::all_of(values, [](const T v) { return v >= T(0) && std::isfinite(v); }));
+        CHECK(std::abs(mean(values) - 1.0) < 0.01);
+        CHECK(std::abs(variance(values) - 1.0) < 0.03);
+        CHECK(std::abs(fraction(values, [](const T v) { return v > T(3); }) - 0.04979) < 0.003);
+
+        // the tail past R = 7.7
+        CHECK(fraction(values, [](const T v) { return v > T(8); }) > 0.0);
+
+        ztd::fill_exponential(std::span(values), T(4));
+        CHECK(std::abs(mean(values) - 0.25) < 0.005);
+    }
+
+    TEST_CASE("fill_random bool")
+    {
+        for (const std::size_t size : {0uz, 1uz, 63uz, 64uz, 65uz})
+        {
+            auto values = std::make_unique<bool[]>(size + 1);
+            values[size] = true;
+            ztd::fill_random(std::span(values.get(), size));
+            CHECK(values[size]);
+        }
+
+        auto values = std::make_unique<bool[]>(100'000);
+        ztd::fill_random(std::span(values.get(), 100'000));
+        const auto count = std::count(values.get(), values.get() + 100'000, true);
+        CHECK(count > 49'000);
+        CHECK(count < 51'000);
+
+        auto a = std::make_unique<bool[]>(100);
+        auto b = std::make_unique<bool[]>(100);
+        ztd::random_context ca(6);
+        ztd::random_context cb(6);
+        ztd::fill_random(std::span(a.get(), 100), ca);
+        ztd::fill_random(std::span(b.get(), 100), cb);
+        CHECK(std::equal(a.get(), a.get() + 100, b.get()));
+    }
+}
@@ -0,0 +1,126 @@
+/**
+ * Copyright (C) 2025 Brandon Zorn <brandonzorn@cock.li>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <set>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <doctest/doctest.h>
+
+#include "ztd/detail/secure_random.hxx"
+
+TEST_SUITE("ztd::secure_random" * doctest::description(""))
+{
+    TEST_CASE("secure_random_bytes")
+    {
+        // smaller than, equal to and larger than the per-thread buffer
+        for (const std::size_t size : {0uz, 1uz, 33uz, 4095uz, 4096uz, 10'000uz})
+        {
+            std::vector<std::byte> bytes(size + 1, std::byte(0xaa));
+            ztd::secure_random_bytes(std::span(bytes).first(size));
+            CHECK_EQ(bytes.back(), std::byte(0xaa));
+        }
+
+        // every byte value shows up
+        std::vector<std::byte> bytes(100'000);
+        ztd::secure_random_bytes(std::span(bytes));
+        CHECK_EQ(std::set(bytes.begin(), bytes.end()).size(), 256);
+
+        // consecutive small requests do not repeat
+        std::array<std::byte, 16> a;
+        std::array<std::byte, 16> b;
+        ztd::secure_random_bytes(a);
+        ztd::secure_random_bytes(b);
+        CHECK_NE(a, b);
+    }
+
+    TEST_CASE("secure_random_hex")
+    {
+        CHECK_EQ(ztd::secure_random_hex().size(), 32);
+
+        for (const std::size_t size : {0uz, 1uz, 2uz, 511uz, 512uz, 513uz, 2000uz})
+        {
+            const auto hex = ztd::secure_random_hex(ztd::usize(size));
+            REQUIRE_EQ(hex.size(), size);
+            CHECK(std::ranges::all_of(hex,
+                                      [](const char c)
+                                      {
+                                          return (c >= '0' && c <= '9') || (c >= 'A' && c <= 'F');
+                                      }));
+        }
+
+        const auto hex = ztd::secure_random_hex(1000_usize);
+        CHECK_EQ(std::set(hex.begin(), hex.end()).size(), 16);
+        CHECK_NE(ztd::secure_random_hex(), ztd::secure_random_hex());
+    }
+
+    TEST_CASE("secure_random_string")
+    {
+        CHECK_EQ(ztd::secure_random_string().size(), 32);
+
+        for (const std::size_t size : {0uz, 1uz, 255uz, 256uz, 257uz, 2000uz})
+        {
+            const auto str = ztd::secure_random_string(ztd::usize(size));
+            REQUIRE_EQ(str.size(), size);
+            CHECK(std::ranges::all_of(str,
+                                      [](const char c)
+                                      {
+                                          return (c >= '0' && c <= '9') || (c >= 'A' && c <= 'Z') ||
+                                                 (c >= 'a' && c <= 'z');
+                                      }));
+        }
+
+        const auto str = ztd::secure_random_string(5000_usize);
+        CHECK_EQ(std::set(str.begin(), str.end()).size(), 62);
+        CHECK_NE(ztd::secure_random_string(), ztd::secure_random_string());
+    }
+
+    TEST_CASE("fork")
+    {
+        // prime the buffer, the child must not hand out the same bytes
+        (void)ztd::secure_random_hex(4_usize);
+
+        int fds[2];
+        REQUIRE_EQ(::pipe(fds), 0);
+
+        const auto pid = ::fork();
+        REQUIRE(pid >= 0);
+        if (pid == 0)
+        {
+            const auto token = ztd::secure_random_hex(32_usize);
+            (void)!::write(fds[1], token.data(), token.size());
+            ::_exit(0);
+        }
+
+        const auto parent = ztd::secure_random_hex(32_usize);
+        std::string child(32, '\0');
+        const auto n = ::read(fds[0], child.data(), child.size());
+        ::waitpid(pid, nullptr, 0);
+        ::close(fds[0]);
+        ::close(fds[1]);
+
+        CHECK_EQ(n, 32);
+        CHECK_NE(parent, child);
+    }
+}
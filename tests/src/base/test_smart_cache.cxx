@@ -16,14 +16,23 @@
  */
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
 #include <functional>
+#include <future>
+#include <latch>
 #include <memory>
 #include <ranges>
+#include <stdexcept>
 #include <string>
+#include <string_view>
+#include <thread>
 #include <vector>
 
 #include <doctest/doctest.h>
 
+#include "ztd/detail/hash.hxx"
 #include "ztd/detail/smart_cache.hxx"
 #include "ztd/detail/string_python.hxx"
 #include "ztd/detail/string_random.hxx"
@@ -48,6 +57,9 @@ smart_cache_data::create(const ztd::i32 data) noexcept
     return std::make_shared<smart_cache_data>(data);
 }
 
+template<typename Cache>
+concept has_view_lookup = requires(const Cache& c) { c.at(std::string_view("key")); };
+
 TEST_SUITE("ztd::smart_cache" * doctest::description(""))
 {
     TEST_CASE("smart_cache")
@@ -309,4 +321,653 @@ TEST_SUITE("ztd::smart_cache" * doctest::description(""))
 
         CHECK_EQ(global_smart_cache_destructor_count, count);
     }
+
+    TEST_CASE("recreate expired")
+    {
+        ztd::smart_cache<std::string, smart_cache_data> smart_cache;
+
+        auto value = smart_cache.create("value", std::bind(&smart_cache_data::create, 1_i32));
+        value = nullptr;
+        CHECK_EQ(smart_cache.at("value"), nullptr);
+
+        // the expired entry is replaced
+        value = smart_cache.create("value", std::bind(&smart_cache_data::create, 2_i32));
+        CHECK_EQ(smart_cache.at("value")->data, 2_i32);
+    }
+
+    TEST_CASE("shards")
+    {
+        using cache = ztd::smart_cache<int, smart_cache_data>;
+
+        CHECK_EQ(cache().shard_count(), cache::default_shards);
+        CHECK_EQ(cache(0).shard_count(), 1);
+
+        for (const std::size_t shards : {1uz, 3uz, 64uz})
+        {
+            cache smart_cache(shards);
+            CHECK_EQ(smart_cache.shard_count(), shards);
+
+            std::vector<std::shared_ptr<smart_cache_data>> values;
+            for (const auto i : std::views::iota(0, 100))
+            {
+                values.push_back(smart_cache.create(
+                    i,
+                    std::bind(&smart_cache_data::create, ztd::i32(i))));
+            }
+            CHECK_EQ(smart_cache.size(), 100);
+            CHECK_EQ(smart_cache.keys().size(), 100);
+            CHECK_EQ(smart_cache.items().size(), 100);
+            for (const auto i : std::views::iota(0, 100))
+            {
+                CHECK_EQ(smart_cache.at(i)->data, ztd::i32(i));
+            }
+
+            smart_cache.erase(5);
+            CHECK_EQ(smart_cache.contains(5), false);
+            CHECK_EQ(smart_cache.size(), 99);
+        }
+    }
+
+    TEST_CASE("threads")
+    {
+        // not smart_cache_data, its destructor counter is not atomic
+        struct data final
+        {
+            ztd::i32 data;
+        };
+
+        ztd::smart_cache<int, data> smart_cache;
+
+        // every thread creates, reads, erases and drops the same keys
+        std::vector<std::thread> threads;
+        std::vector<std::int32_t> mismatches(8);
+        for (const auto t : std::views::iota(0uz, mismatches.size()))
+        {
+            threads.emplace_back(
+                [&smart_cache, &mismatches, t]
+                {
+                    for (const auto round : std::views::iota(0, 200))
+                    {
+                        std::vector<std::shared_ptr<data>> held;
+                        for (const auto key : std::views::iota(0, 50))
+                        {
+                            auto value = smart_cache.create(
+                                key,
+                                [key] { return std::make_shared<data>(ztd::i32(key)); },
+                                round % 10 == 0);
+                            const auto cached = smart_cache.at(key);
+                            if (value->data != ztd::i32(key) ||
+                                (cached != nullptr && cached->data != ztd::i32(key)))
+                            {
+                                ++mismatches[t];
+                            }
+                            held.push_back(std::move(value));
+                        }
+                        (void)smart_cache.keys();
+                        (void)smart_cache.size();
+                        if (round % 7 == 0)
+                        {
+                            smart_cache.erase(round % 50);
+                        }
+                    }
+                });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        CHECK(std::ranges::all_of(mismatches, [](const auto m) { return m == 0; }));
+        smart_cache.clear();
+        CHECK(smart_cache.empty());
+    }
+
+    TEST_CASE("expired entries are swept")
+    {
+        ztd::smart_cache<int, smart_cache_data> smart_cache(1);
+
+        // only a few values are alive at a time, the cache must not keep an
+        // entry for every key it has seen
+        std::shared_ptr<smart_cache_data> alive;
+        for (const auto i : std::views::iota(0, 10'000))
+        {
+            alive = smart_cache.create(i, std::bind(&smart_cache_data::create, ztd::i32(i)));
+            CHECK_LE(smart_cache.count(i), 1);
+        }
+        std::size_t entries = 0;
+        for (const auto i : std::views::iota(0, 10'000))
+        {
+            entries += smart_cache.count(i);
+        }
+        CHECK_LE(entries, 128);
+        CHECK_EQ(smart_cache.size(), 1);
+        CHECK_EQ(smart_cache.at(9'999), alive);
+    }
+
+    TEST_CASE("compact")
+    {
+        ztd::smart_cache<int, smart_cache_data> smart_cache;
+
+        std::vector<std::shared_ptr<smart_cache_data>> values;
+        for (const auto i : std::views::iota(0, 40))
+        {
+            values.push_back(
+                smart_cache.create(i, std::bind(&smart_cache_data::create, ztd::i32(i))));
+        }
+        values.resize(10);
+
+        CHECK_EQ(smart_cache.compact(), 30);
+        CHECK_EQ(smart_cache.compact(), 0);
+        CHECK_EQ(smart_cache.size(), 10);
+        for (const auto i : std::views::iota(0, 40))
+        {
+            CHECK_EQ(smart_cache.count(i), i < 10 ? 1 : 0);
+        }
+
+        // pinned values are never expired
+        auto pinned = smart_cache.create(100, std::bind(&smart_cache_data::create, 100_i32), true);
+        pinned = nullptr;
+        CHECK_EQ(smart_cache.compact(), 0);
+        CHECK_EQ(smart_cache.at(100)->data, 100_i32);
+    }
+
+    TEST_CASE("bounded")
+    {
+        for (const auto eviction :
+             {ztd::cache_eviction::lru, ztd::cache_eviction::clock, ztd::cache_eviction::tinylfu})
+        {
+            global_smart_cache_destructor_count = 0;
+
+            ztd::smart_cache<int, smart_cache_data> smart_cache(8, eviction, 1);
+            CHECK_EQ(smart_cache.capacity(), 8);
+
+            // nobody holds the values, only the cache keeps them alive
+            for (const auto i : std::views::iota(0, 100))
+            {
+                (void)smart_cache.create(i, std::bind(&smart_cache_data::create, ztd::i32(i)));
+            }
+            CHECK_EQ(smart_cache.size(), 8);
+            CHECK_EQ(global_smart_cache_destructor_count, 92);
+
+            // pinned values do not count towards the capacity
+            (void)smart_cache.create(100, std::bind(&smart_cache_data::create, 100_i32), true);
+            CHECK_EQ(smart_cache.size(), 9);
+
+            auto stats = smart_cache.stats();
+            CHECK_EQ(stats.hits, 0);
+            CHECK_EQ(stats.misses, 101);
+            CHECK_EQ(stats.evictions, 92);
+
+            for (const auto key : smart_cache.keys())
+            {
+                CHECK_NE(smart_cache.at(key), nullptr);
+            }
+            CHECK_EQ(smart_cache.at(-1), nullptr);
+            stats = smart_cache.stats();
+            CHECK_EQ(stats.hits, 9);
+            CHECK_EQ(stats.misses, 102);
+
+            const auto keys = smart_cache.keys();
+            smart_cache.erase(keys.front());
+            CHECK_EQ(smart_cache.size(), 8);
+            CHECK_EQ(global_smart_cache_destructor_count, 93);
+
+            smart_cache.clear();
+            CHECK(smart_cache.empty());
+            CHECK_EQ(global_smart_cache_destructor_count, 101);
+        }
+    }
+
+    TEST_CASE("capacity 0")
+    {
+        global_smart_cache_destructor_count = 0;
+
+        // not bounded, no value is kept alive by the cache
+        ztd::smart_cache<int, smart_cache_data> smart_cache(0, ztd::cache_eviction::lru);
+        CHECK_EQ(smart_cache.capacity(), 0);
+        CHECK_EQ(smart_cache.shard_count(), ztd::smart_cache<int, int>::default_shards);
+
+        for (const auto i : std::views::iota(0, 10))
+        {
+            (void)smart_cache.create(i, std::bind(&smart_cache_data::create, ztd::i32(i)));
+        }
+        CHECK(smart_cache.empty());
+        CHECK_EQ(global_smart_cache_destructor_count, 10);
+        CHECK_EQ(smart_cache.stats().evictions, 0);
+    }
+
+    TEST_CASE("bounded shards")
+    {
+        ztd::smart_cache<int, smart_cache_data> smart_cache(10, ztd::cache_eviction::lru, 4);
+        CHECK_EQ(smart_cache.shard_count(), 4);
+        CHECK_EQ(smart_cache.capacity(), 10);
+
+        for (const auto i : std::views::iota(0, 1'000))
+        {
+            (void)smart_cache.create(i, std::bind(&smart_cache_data::create, ztd::i32(i)));
+        }
+        CHECK_EQ(smart_cache.size(), 10);
+
+        // never more shards than values
+        ztd::smart_cache<int, smart_cache_data> small(2, ztd::cache_eviction::lru, 16);
+        CHECK_EQ(small.shard_count(), 2);
+    }
+
+    TEST_CASE("lru")
+    {
+        for (const auto eviction : {ztd::cache_eviction::lru, ztd::cache_eviction::clock})
+        {
+            ztd::smart_cache<int, smart_cache_data> smart_cache(3, eviction, 1);
+            for (const auto i : std::views::iota(0, 3))
+            {
+                (void)smart_cache.create(i, std::bind(&smart_cache_data::create, ztd::i32(i)));
+            }
+
+            // 0 was used, 1 is the oldest that was not
+            CHECK_NE(smart_cache.at(0), nullptr);
+            (void)smart_cache.create(3, std::bind(&smart_cache_data::create, 3_i32));
+            CHECK(smart_cache.contains(0));
+            CHECK_FALSE(smart_cache.contains(1));
+            CHECK(smart_cache.contains(2));
+            CHECK(smart_cache.contains(3));
+
+            // a held value is evicted from the cache, but not destroyed
+            auto held = smart_cache.at(2);
+            (void)smart_cache.create(4, std::bind(&smart_cache_data::create, 4_i32));
+            (void)smart_cache.create(5, std::bind(&smart_cache_data::create, 5_i32));
+            (void)smart_cache.create(6, std::bind(&smart_cache_data::create, 6_i32));
+            CHECK_EQ(smart_cache.at(2), held);
+        }
+    }
+
+    TEST_CASE("tinylfu")
+    {
+        // a few hot keys, then a scan over many keys that are only used once
+        const auto hot_survives = [](const ztd::cache_eviction eviction)
+        {
+            ztd::smart_cache<int, smart_cache_data> smart_cache(100, eviction, 1);
+            for (const auto round : std::views::iota(0, 5))
+            {
+                for (const auto i : std::views::iota(0, 10))
+                {
+                    (void)round;
+                    (void)smart_cache.create(i, std::bind(&smart_cache_data::create, ztd::i32(i)));
+                }
+            }
+            for (const auto i : std::views::iota(1'000, 2'000))
+            {
+                (void)smart_cache.create(i, std::bind(&smart_cache_data::create, ztd::i32(i)));
+            }
+            return std::ranges::all_of(std::views::iota(0, 10),
+                                       [&](const auto i) { return smart_cache.contains(i); });
+        };
+
+        CHECK(hot_survives(ztd::cache_eviction::tinylfu));
+        CHECK_FALSE(hot_survives(ztd::cache_eviction::lru));
+    }
+
+    TEST_CASE("bounded threads")
+    {
+        struct data final
+        {
+            ztd::i32 data;
+        };
+
+        for (const auto eviction :
+             {ztd::cache_eviction::lru, ztd::cache_eviction::clock, ztd::cache_eviction::tinylfu})
+        {
+            ztd::smart_cache<int, data> smart_cache(16, eviction, 4);
+
+            std::vector<std::thread> threads;
+            std::vector<std::int32_t> mismatches(4);
+            for (const auto t : std::views::iota(0uz, mismatches.size()))
+            {
+                threads.emplace_back(
+                    [&smart_cache, &mismatches, t]
+                    {
+                        for (const auto i : std::views::iota(0, 2'000))
+                        {
+                            // skewed, the low keys are hot
+                            const auto key = (i * 7919) % (1 + (i % 64));
+                            const auto value = smart_cache.create(
+                                key,
+                                [key] { return std::make_shared<data>(ztd::i32(key)); });
+                            const auto cached = smart_cache.at(key);
+                            if (value->data != ztd::i32(key) ||
+                                (cached != nullptr && cached->data != ztd::i32(key)))
+                            {
+                                ++mismatches[t];
+                            }
+                            if (i % 97 == 0)
+                            {
+                                smart_cache.erase(key);
+                            }
+                        }
+                    });
+            }
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+
+            CHECK(std::ranges::all_of(mismatches, [](const auto m) { return m == 0; }));
+            CHECK_LE(smart_cache.size(), 16);
+            const auto stats = smart_cache.stats();
+            CHECK_EQ(stats.hits + stats.misses, 2 * 4 * 2'000);
+        }
+    }
+
+    TEST_CASE("single flight")
+    {
+        struct data final
+        {
+            ztd::i32 data;
+        };
+
+        ztd::smart_cache<int, data> smart_cache(1);
+
+        // every thread asks for the same missing key at once, only one of
+        // them may create it
+        std::atomic<std::int32_t> created = 0;
+        std::latch start(8);
+        std::vector<std::shared_ptr<data>> values(8);
+        std::vector<std::thread> threads;
+        for (const auto t : std::views::iota(0uz, values.size()))
+        {
+            threads.emplace_back(
+                [&, t]
+                {
+                    start.arrive_and_wait();
+                    values[t] = smart_cache.create(1,
+                                                   [&created]
+                                                   {
+                                                       created.fetch_add(1);
+                                                       std::this_thread::sleep_for(
+                                                           std::chrono::milliseconds(50));
+                                                       return std::make_shared<data>(1_i32);
+                                                   });
+                });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        CHECK_EQ(created.load(), 1);
+        CHECK(std::ranges::all_of(values, [&](const auto& v) { return v == values.front(); }));
+        CHECK_EQ(smart_cache.stats().misses, 1);
+        CHECK_EQ(smart_cache.stats().hits, 7);
+    }
+
+    TEST_CASE("creator without lock")
+    {
+        ztd::smart_cache<int, smart_cache_data> smart_cache(1);
+
+        SUBCASE("nested")
+        {
+            // the creator uses the cache, for a key in the same shard
+            std::shared_ptr<smart_cache_data> inner;
+            const auto outer = smart_cache.create(
+                1,
+                [&]
+                {
+                    inner = smart_cache.create(2, std::bind(&smart_cache_data::create, 2_i32));
+                    return smart_cache_data::create(1_i32);
+                });
+            CHECK_EQ(smart_cache.at(1), outer);
+            CHECK_EQ(smart_cache.at(2), inner);
+        }
+
+        SUBCASE("parallel")
+        {
+            // a slow creator does not hold up another key of the same shard
+            std::atomic<bool> other_done = false;
+            std::atomic<bool> seen = false;
+            const auto slow_creator = [&]
+            {
+                const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+                while (!other_done && std::chrono::steady_clock::now() < deadline)
+                {
+                    std::this_thread::yield();
+                }
+                seen = other_done.load();
+                return smart_cache_data::create(1_i32);
+            };
+            std::thread slow([&] { (void)smart_cache.create(1, slow_creator); });
+
+            // until the slow creator is running
+            while (smart_cache.stats().misses == 0)
+            {
+                std::this_thread::yield();
+            }
+            (void)smart_cache.create(2, std::bind(&smart_cache_data::create, 2_i32));
+            other_done = true;
+            slow.join();
+            CHECK(seen);
+        }
+    }
+
+    TEST_CASE("heterogeneous lookup")
+    {
+        using string_cache =
+            ztd::smart_cache<std::string, smart_cache_data, ztd::string_hash, ztd::string_equal>;
+
+        // only a transparent cache takes keys that are not a KType
+        using plain_cache = ztd::smart_cache<std::string, smart_cache_data>;
+        static_assert(!has_view_lookup<plain_cache>);
+        static_assert(has_view_lookup<string_cache>);
+
+        SUBCASE("string")
+        {
+            string_cache smart_cache;
+
+            const std::string_view key = "value_1";
+            const auto value = smart_cache.create(key, std::bind(&smart_cache_data::create, 1_i32));
+
+            CHECK_EQ(smart_cache.at(key), value);
+            CHECK_EQ(smart_cache.at("value_1"), value);
+            CHECK_EQ(smart_cache.at(std::string("value_1")), value);
+            CHECK_EQ(smart_cache.count(key), 1);
+            CHECK(smart_cache.contains(key));
+            CHECK_FALSE(smart_cache.contains(std::string_view("value_2")));
+
+            // a hit does not call the creator
+            CHECK_EQ(smart_cache.create(key, [] { return nullptr; }), value);
+            CHECK_EQ(smart_cache.keys(), std::vector<std::string>{"value_1"});
+
+            smart_cache.erase(key);
+            CHECK_FALSE(smart_cache.contains(key));
+        }
+
+        SUBCASE("path")
+        {
+            ztd::smart_cache<std::filesystem::path,
+                             smart_cache_data,
+                             ztd::string_hash,
+                             ztd::string_equal>
+                smart_cache(4, ztd::cache_eviction::lru);
+
+            (void)smart_cache.create(std::filesystem::path("/usr/bin"),
+                                     std::bind(&smart_cache_data::create, 1_i32));
+            (void)smart_cache.create(std::string_view("/usr/lib"),
+                                     std::bind(&smart_cache_data::create, 2_i32));
+
+            CHECK_EQ(smart_cache.at(std::string_view("/usr/bin"))->data, 1_i32);
+            CHECK_EQ(smart_cache.at(std::filesystem::path("/usr/lib"))->data, 2_i32);
+            CHECK_EQ(smart_cache.at("/usr/lib")->data, 2_i32);
+            CHECK_EQ(smart_cache.stats().hits, 3);
+
+            smart_cache.erase("/usr/bin");
+            CHECK_EQ(smart_cache.at("/usr/bin"), nullptr);
+            CHECK_EQ(smart_cache.size(), 1);
+        }
+    }
+
+    TEST_CASE("creator")
+    {
+        ztd::smart_cache<int, smart_cache_data> smart_cache;
+
+        // any callable, also one that can only be moved
+        auto data = std::make_unique<ztd::i32>(1_i32);
+        const auto value = smart_cache.create(
+            1,
+            [data = std::move(data)] { return smart_cache_data::create(*data); });
+        CHECK_EQ(value->data, 1_i32);
+
+        // a creator that returns a derived type, or nullptr on a hit
+        CHECK_EQ(smart_cache.create(1, [] { return nullptr; }), value);
+    }
+
+    TEST_CASE("create_async")
+    {
+        struct data final
+        {
+            ztd::i32 data;
+        };
+
+        SUBCASE("miss and hit")
+        {
+            ztd::smart_cache<int, data> smart_cache;
+
+            auto future = smart_cache.create_async(
+                1,
+                []
+                {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                    return std::make_shared<data>(1_i32);
+                });
+            const auto value = future.get();
+            CHECK_EQ(value->data, 1_i32);
+            CHECK_EQ(smart_cache.at(1), value);
+
+            // a cached value is ready right away, and the creator is not used
+            auto hit = smart_cache.create_async(1, [] { return nullptr; });
+            CHECK_EQ(hit.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+            CHECK_EQ(hit.get(), value);
+
+            const auto stats = smart_cache.stats();
+            CHECK_EQ(stats.hits, 2);
+            CHECK_EQ(stats.misses, 1);
+        }
+
+        SUBCASE("single flight")
+        {
+            ztd::smart_cache<int, data> smart_cache;
+
+            std::atomic<std::int32_t> created = 0;
+            std::latch release(1);
+            const auto creator = [&]
+            {
+                created.fetch_add(1);
+                release.wait();
+                return std::make_shared<data>(2_i32);
+            };
+
+            auto a = smart_cache.create_async(2, creator);
+            auto b = smart_cache.create_async(2, creator);
+            std::shared_ptr<data> waited;
+            std::thread waiter([&] { waited = smart_cache.create(2, creator); });
+            release.count_down();
+
+            CHECK_EQ(a.get(), b.get());
+            waiter.join();
+            CHECK_EQ(waited, a.get());
+            CHECK_EQ(created.load(), 1);
+        }
+
+        SUBCASE("exception")
+        {
+            ztd::smart_cache<int, data> smart_cache;
+
+            auto future = smart_cache.create_async(
+                3,
+                []() -> std::shared_ptr<data> { throw std::runtime_error("creator"); });
+            CHECK_THROWS_AS((void)future.get(), std::runtime_error);
+            CHECK_FALSE(smart_cache.contains(3));
+
+            // the key is not stuck in flight
+            CHECK_EQ(smart_cache.create(3, [] { return std::make_shared<data>(3_i32); })->data,
+                     3_i32);
+        }
+
+        SUBCASE("waiter after an exception")
+        {
+            ztd::smart_cache<int, data> smart_cache;
+
+            std::latch release(1);
+            auto future = smart_cache.create_async(
+                5,
+                [&]() -> std::shared_ptr<data>
+                {
+                    release.wait();
+                    throw std::runtime_error("creator");
+                });
+
+            std::shared_ptr<data> waited;
+            std::thread waiter(
+                [&]
+                {
+                    waited = smart_cache.create(5, [] { return std::make_shared<data>(5_i32); });
+                });
+            // the waiter found the creation in flight
+            while (smart_cache.stats().hits == 0)
+            {
+                std::this_thread::yield();
+            }
+            release.count_down();
+            waiter.join();
+
+            CHECK_THROWS_AS((void)future.get(), std::runtime_error);
+            REQUIRE(waited != nullptr);
+            CHECK_EQ(waited->data, 5_i32);
+            CHECK_EQ(smart_cache.at(5), waited);
+        }
+
+        SUBCASE("bounded workers")
+        {
+            ztd::smart_cache<int, data> smart_cache;
+
+            std::atomic<std::uint32_t> running = 0;
+            std::atomic<std::uint32_t> most = 0;
+            std::vector<std::shared_future<std::shared_ptr<data>>> futures;
+            for (const auto i : std::views::iota(0, 64))
+            {
+                futures.push_back(smart_cache.create_async(
+                    i,
+                    [&]
+                    {
+                        const auto now = running.fetch_add(1) + 1;
+                        auto seen = most.load();
+                        while (now > seen && !most.compare_exchange_weak(seen, now))
+                        {
+                        }
+                        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                        running.fetch_sub(1);
+                        return std::make_shared<data>(1_i32);
+                    }));
+            }
+            for (const auto& future : futures)
+            {
+                CHECK_NE(future.get(), nullptr);
+            }
+            CHECK_LE(most.load(), std::max(std::thread::hardware_concurrency(), 1u));
+        }
+
+        SUBCASE("destroyed while pending")
+        {
+            std::shared_future<std::shared_ptr<data>> future;
+            {
+                ztd::smart_cache<int, data> smart_cache;
+                future = smart_cache.create_async(
+                    4,
+                    []
+                    {
+                        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+                        return std::make_shared<data>(4_i32);
+                    });
+            }
+            CHECK_EQ(future.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+            CHECK_EQ(future.get()->data, 4_i32);
+        }
+    }
 }
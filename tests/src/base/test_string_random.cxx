@@ -15,7 +15,12 @@
  * along with this program. If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
+#include <array>
+#include <set>
+#include <span>
 #include <string>
+#include <string_view>
 
 #include <doctest/doctest.h>
 
@@ -187,4 +192,84 @@ TEST_SUITE("ztd::random_hex" * doctest::description(""))
         CHECK_EQ(rand_str_string.contains("Y"), true);
         CHECK_EQ(rand_str_string.contains("Z"), true);
     }
+
+    TEST_CASE("random_hex buffer")
+    {
+        // every length around a whole draw
+        for (std::size_t size = 0; size < 40; ++size)
+        {
+            std::string buffer(size + 1, '#');
+            ztd::random_hex(std::span(buffer.data(), size));
+            CHECK_EQ(buffer.back(), '#');
+            CHECK(std::ranges::all_of(buffer.substr(0, size),
+                                      [](const char c)
+                                      {
+                                          return (c >= '0' && c <= '9') || (c >= 'A' && c <= 'F');
+                                      }));
+        }
+    }
+
+    TEST_CASE("random_string buffer")
+    {
+        for (std::size_t size = 0; size < 40; ++size)
+        {
+            std::string buffer(size + 1, '#');
+            ztd::random_string(std::span(buffer.data(), size));
+            CHECK_EQ(buffer.back(), '#');
+            CHECK(std::ranges::all_of(buffer.substr(0, size),
+                                      [](const char c)
+                                      {
+                                          return (c >= '0' && c <= '9') || (c >= 'A' && c <= 'Z') ||
+                                                 (c >= 'a' && c <= 'z');
+                                      }));
+        }
+
+        // the characters are used evenly
+        std::string buffer(62 * 1000, '\0');
+        ztd::random_string(std::span(buffer));
+        for (const char c : std::string_view("09AZaz"))
+        {
+            const auto count = std::ranges::count(buffer, c);
+            CHECK(count > 800);
+            CHECK(count < 1200);
+        }
+    }
+
+    TEST_CASE("random ids")
+    {
+        std::array<char, 1000> arena{};
+        arena.back() = '#';
+
+        const auto hex = ztd::random_hex_ids(std::span(arena), 33_usize);
+        REQUIRE_EQ(hex.size(), 30);
+        CHECK_EQ(arena.back(), '#');
+        for (std::size_t i = 0; i < hex.size(); ++i)
+        {
+            CHECK_EQ(hex[i].size(), 33);
+            CHECK_EQ(hex[i].data(), arena.data() + i * 33);
+        }
+        CHECK_EQ(std::set(hex.begin(), hex.end()).size(), hex.size());
+
+        const auto strings = ztd::random_string_ids(std::span(arena), 10_usize);
+        REQUIRE_EQ(strings.size(), 100);
+        CHECK_EQ(std::set(strings.begin(), strings.end()).size(), strings.size());
+
+        CHECK(ztd::random_hex_ids(std::span(arena).first(5), 10_usize).empty());
+    }
+
+    TEST_CASE("random_context")
+    {
+        ztd::random_context a(5);
+        ztd::random_context b(5);
+
+        CHECK_EQ(ztd::random_hex(a, 40_usize), ztd::random_hex(b, 40_usize));
+        CHECK_EQ(ztd::random_string(a, 40_usize), ztd::random_string(b, 40_usize));
+        CHECK_EQ(ztd::random_hex(a), ztd::random_hex(b));
+
+        std::string x(25, '\0');
+        std::string y(25, '\0');
+        ztd::random_string(a, std::span(x));
+        ztd::random_string(b, std::span(y));
+        CHECK_EQ(x, y);
+    }
 }
@@ -0,0 +1,259 @@
+/**
+ * Copyright (C) 2025 Brandon Zorn <brandonzorn@cock.li>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <array>
+#include <charconv>
+#include <format>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "ztd/detail/types.hxx"
+
+TEST_SUITE("integer<T> charconv" * doctest::description(""))
+{
+    TEST_CASE_TEMPLATE("round trip ",
+                       Integer,
+                       ztd::v2::i8,
+                       ztd::v2::i16,
+                       ztd::v2::i32,
+                       ztd::v2::i64,
+                       ztd::v2::u8,
+                       ztd::v2::u16,
+                       ztd::v2::u32,
+                       ztd::v2::u64)
+    {
+        using type = typename Integer::integer_type;
+
+        const std::vector<Integer> values{
+            Integer::MIN(),
+            Integer::MAX(),
+            Integer(type(0)),
+            Integer(type(1)),
+            Integer(type(9)),
+            Integer(type(10)),
+            Integer(type(99)),
+            Integer(type(100)),
+            Integer::MAX() / Integer(type(3)),
+        };
+
+        for (const int base : {10, 16})
+        {
+            for (const auto value : values)
+            {
+                std::array<char, 32> expected{};
+                const auto e = std::to_chars(expected.data(),
+                                             expected.data() + expected.size(),
+                                             value.data(),
+                                             base);
+
+                std::array<char, 32> buffer{};
+                const auto r =
+                    ztd::to_chars(buffer.data(), buffer.data() + buffer.size(), value, base);
+                REQUIRE(r.ec == std::errc());
+                CHECK_EQ(std::string_view(buffer.data(), r.ptr),
+                         std::string_view(expected.data(), e.ptr));
+
+                Integer parsed;
+                const auto p = ztd::from_chars(buffer.data(), r.ptr, parsed, base);
+                REQUIRE(p.ec == std::errc());
+                CHECK_EQ(p.ptr, r.ptr);
+                CHECK_EQ(parsed, value);
+            }
+        }
+    }
+
+    TEST_CASE("to_chars()")
+    {
+        SUBCASE("buffer too small")
+        {
+            std::array<char, 4> buffer{};
+            const auto r = ztd::to_chars(buffer.data(), buffer.data() + buffer.size(), 12345_i32);
+            CHECK(r.ec == std::errc::value_too_large);
+            CHECK_EQ(r.ptr, buffer.data() + buffer.size());
+        }
+
+        SUBCASE("exact buffer")
+        {
+            std::array<char, 6> buffer{};
+            const auto r = ztd::to_chars(buffer.data(), buffer.data() + buffer.size(), -12345_i32);
+            REQUIRE(r.ec == std::errc());
+            CHECK_EQ(std::string_view(buffer.data(), r.ptr), "-12345");
+        }
+    }
+
+    TEST_CASE("from_chars()")
+    {
+        SUBCASE("many digits")
+        {
+            // long enough to take the 8 digits at a time path more than once
+            const std::string_view str = "12345678901234567890";
+            ztd::u64 value;
+            const auto r = ztd::from_chars(str.data(), str.data() + str.size(), value);
+            REQUIRE(r.ec == std::errc());
+            CHECK_EQ(value, 12345678901234567890_u64);
+        }
+
+        SUBCASE("leading zeros")
+        {
+            const std::string_view str = "0000000000000000000042";
+            ztd::u8 value;
+            const auto r = ztd::from_chars(str.data(), str.data() + str.size(), value);
+            REQUIRE(r.ec == std::errc());
+            CHECK_EQ(value, 42);
+        }
+
+        SUBCASE("stops at the first non digit")
+        {
+            const std::string_view str = "1234567x9";
+            ztd::i32 value;
+            const auto r = ztd::from_chars(str.data(), str.data() + str.size(), value);
+            REQUIRE(r.ec == std::errc());
+            CHECK_EQ(r.ptr, str.data() + 7);
+            CHECK_EQ(value, 1234567);
+        }
+
+        SUBCASE("out of range")
+        {
+            const std::string_view str = "18446744073709551616";
+            ztd::u64 value = 7_u64;
+            const auto r = ztd::from_chars(str.data(), str.data() + str.size(), value);
+            CHECK(r.ec == std::errc::result_out_of_range);
+            CHECK_EQ(r.ptr, str.data() + str.size());
+            CHECK_EQ(value, 7);
+        }
+
+        SUBCASE("MIN")
+        {
+            const std::string_view str = "-9223372036854775808";
+            ztd::i64 value;
+            const auto r = ztd::from_chars(str.data(), str.data() + str.size(), value);
+            REQUIRE(r.ec == std::errc());
+            CHECK_EQ(value, ztd::i64::MIN());
+        }
+
+        SUBCASE("invalid")
+        {
+            for (const std::string_view str : {"", "-", "+1", "x1"})
+            {
+                ztd::i32 value;
+                const auto r = ztd::from_chars(str.data(), str.data() + str.size(), value);
+                CHECK(r.ec == std::errc::invalid_argument);
+                CHECK_EQ(r.ptr, str.data());
+            }
+
+            const std::string_view str = "-1";
+            ztd::u32 value;
+            CHECK(ztd::from_chars(str.data(), str.data() + str.size(), value).ec ==
+                  std::errc::invalid_argument);
+        }
+
+        SUBCASE("hex")
+        {
+            const std::string_view str = "DeadBeef";
+            ztd::u32 value;
+            const auto r = ztd::from_chars(str.data(), str.data() + str.size(), value, 16);
+            REQUIRE(r.ec == std::errc());
+            CHECK_EQ(value, 0xDEADBEEF_u32);
+        }
+    }
+
+    TEST_CASE("parse_column()")
+    {
+        SUBCASE("OK")
+        {
+            const auto result = ztd::parse_column<ztd::i32>("1\n-22\n333\n4444");
+            REQUIRE(result);
+            CHECK_EQ(result.value(), std::vector<ztd::i32>{1_i32, -22_i32, 333_i32, 4444_i32});
+        }
+
+        SUBCASE("trailing delimiter")
+        {
+            const auto result = ztd::parse_column<ztd::u16>("10,20,30,", ',');
+            REQUIRE(result);
+            CHECK_EQ(result.value(), std::vector<ztd::u16>{10_u16, 20_u16, 30_u16});
+        }
+
+        SUBCASE("empty")
+        {
+            const auto result = ztd::parse_column<ztd::u16>("");
+            REQUIRE(result);
+            CHECK(result.value().empty());
+        }
+
+        SUBCASE("bad field")
+        {
+            CHECK_EQ(ztd::parse_column<ztd::u8>("1\n2\n256\n4").error(), 2);
+            CHECK_EQ(ztd::parse_column<ztd::u8>("1\n\n3").error(), 1);
+            CHECK_EQ(ztd::parse_column<ztd::u8>("1\n2x\n3").error(), 1);
+            CHECK_EQ(ztd::parse_column<ztd::u8>("1\n2\n\n").error(), 2);
+        }
+    }
+
+    TEST_CASE("format_column()")
+    {
+        const std::vector<ztd::i64> values{0_i64, -1_i64, ztd::i64::MIN(), ztd::i64::MAX()};
+
+        SUBCASE("base 10")
+        {
+            const auto str = ztd::format_column(std::span(values));
+            REQUIRE(str);
+            CHECK_EQ(str.value(), "0\n-1\n-9223372036854775808\n9223372036854775807");
+
+            const auto parsed = ztd::parse_column<ztd::i64>(str.value());
+            REQUIRE(parsed);
+            CHECK_EQ(parsed.value(), values);
+        }
+
+        SUBCASE("base 16")
+        {
+            const auto str = ztd::format_column(std::span(values), ' ', 16);
+            REQUIRE(str);
+            CHECK_EQ(str.value(), "0 -1 -8000000000000000 7fffffffffffffff");
+        }
+
+        SUBCASE("empty")
+        {
+            const auto str = ztd::format_column(std::span<const ztd::i64>());
+            REQUIRE(str);
+            CHECK(str.value().empty());
+        }
+
+        SUBCASE("invalid base")
+        {
+            for (const auto base : {0, 2, 8, 36})
+            {
+                const auto str = ztd::format_column(std::span(values), '\n', base);
+                REQUIRE_FALSE(str);
+                CHECK_EQ(str.error(), std::errc::invalid_argument);
+            }
+            CHECK_FALSE(ztd::format_column(std::span<const ztd::i64>(), '\n', 2));
+        }
+    }
+
+    TEST_CASE("std::format")
+    {
+        CHECK_EQ(std::format("{}", -1234_i32), "-1234");
+        CHECK_EQ(std::format("{}", ztd::u64::MAX()), "18446744073709551615");
+        CHECK_EQ(std::format("{:x}", 255_u8), "ff");
+        CHECK_EQ(std::format("{:>5}", 42_u8), "   42");
+    }
+}
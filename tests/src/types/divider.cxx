@@ -0,0 +1,135 @@
+/**
+ * Copyright (C) 2025 Brandon Zorn <brandonzorn@cock.li>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <limits>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "ztd/detail/types.hxx"
+
+TEST_SUITE("divider<T>" * doctest::description(""))
+{
+    TEST_CASE_TEMPLATE("exhaustive ", Integer, ztd::v2::i8, ztd::v2::u8)
+    {
+        using type = typename Integer::integer_type;
+
+        for (int b = std::numeric_limits<type>::min(); b <= std::numeric_limits<type>::max(); ++b)
+        {
+            if (b == 0)
+            {
+                continue;
+            }
+            const auto rhs = Integer(type(b));
+            const auto divider = ztd::divider<Integer>(rhs);
+
+            for (int a = std::numeric_limits<type>::min(); a <= std::numeric_limits<type>::max();
+                 ++a)
+            {
+                const auto lhs = Integer(type(a));
+                REQUIRE_EQ(divider.overflowing_div(lhs), lhs.overflowing_div(rhs));
+                REQUIRE_EQ(divider.overflowing_rem(lhs), lhs.overflowing_rem(rhs));
+                REQUIRE_EQ(divider.overflowing_div_floor(lhs), lhs.overflowing_div_floor(rhs));
+                REQUIRE_EQ(divider.overflowing_div_ceil(lhs), lhs.overflowing_div_ceil(rhs));
+                REQUIRE_EQ(divider.overflowing_div_euclid(lhs), lhs.overflowing_div_euclid(rhs));
+                REQUIRE_EQ(divider.overflowing_rem_euclid(lhs), lhs.overflowing_rem_euclid(rhs));
+            }
+        }
+    }
+
+    TEST_CASE_TEMPLATE("boundaries ",
+                       Integer,
+                       ztd::v2::i16,
+                       ztd::v2::i32,
+                       ztd::v2::i64,
+                       ztd::v2::u16,
+                       ztd::v2::u32,
+                       ztd::v2::u64)
+    {
+        using type = typename Integer::integer_type;
+
+        std::vector<Integer> values{
+            Integer::MIN(),
+            Integer::MAX(),
+            Integer(type(0)),
+            Integer(type(1)),
+            Integer(type(2)),
+            Integer(type(3)),
+            Integer(type(7)),
+            Integer(type(10)),
+            Integer(type(641)),
+            Integer(type(4096)),
+            Integer::MAX() / Integer(type(3)),
+            Integer::MAX() - Integer(type(1)),
+        };
+        if constexpr (ztd::is_signed_integer<Integer>)
+        {
+            for (const auto v : std::vector<Integer>(values))
+            {
+                if (v != Integer::MIN())
+                {
+                    values.push_back(-v);
+                }
+            }
+        }
+
+        for (const auto rhs : values)
+        {
+            if (rhs == 0)
+            {
+                continue;
+            }
+            const auto divider = ztd::divider<Integer>(rhs);
+            CHECK_EQ(divider.divisor(), rhs);
+
+            for (const auto lhs : values)
+            {
+                CHECK_EQ(divider.overflowing_div(lhs), lhs.overflowing_div(rhs));
+                CHECK_EQ(divider.overflowing_rem(lhs), lhs.overflowing_rem(rhs));
+                CHECK_EQ(divider.overflowing_div_floor(lhs), lhs.overflowing_div_floor(rhs));
+                CHECK_EQ(divider.overflowing_div_ceil(lhs), lhs.overflowing_div_ceil(rhs));
+                CHECK_EQ(divider.overflowing_div_euclid(lhs), lhs.overflowing_div_euclid(rhs));
+                CHECK_EQ(divider.overflowing_rem_euclid(lhs), lhs.overflowing_rem_euclid(rhs));
+            }
+        }
+    }
+
+    TEST_CASE("operators")
+    {
+        const auto page_size = ztd::divider(4096_u64);
+
+        CHECK_EQ(8191_u64 / page_size, 1);
+        CHECK_EQ(8191_u64 % page_size, 4095);
+
+        auto x = 1'000'000_u64;
+        x /= page_size;
+        CHECK_EQ(x, 244);
+
+        auto y = 1'000'000_u64;
+        y %= page_size;
+        CHECK_EQ(y, 576);
+
+        const auto seven = ztd::divider(7_i32);
+        const auto z = -100_i32;
+        CHECK_EQ(z / seven, -14);
+        CHECK_EQ(z % seven, -2);
+        CHECK_EQ(z.div_floor(seven), -15);
+        CHECK_EQ(z.div_ceil(seven), -14);
+        CHECK_EQ(z.div_euclid(seven), -15);
+        CHECK_EQ(z.rem_euclid(seven), 5);
+    }
+}
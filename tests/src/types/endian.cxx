@@ -0,0 +1,137 @@
+/**
+ * Copyright (C) 2025 Brandon Zorn <brandonzorn@cock.li>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+#include <doctest/doctest.h>
+
+#include "ztd/detail/types.hxx"
+
+namespace
+{
+// an IPv4 style header, as it is on the wire
+struct header
+{
+    ztd::be<ztd::u16> length;
+    ztd::be<ztd::u16> id;
+    ztd::be<ztd::u32> source;
+    ztd::le<ztd::u64> extra;
+};
+
+template<typename T>
+std::array<std::byte, sizeof(T)>
+bytes(const T value)
+{
+    return std::bit_cast<std::array<std::byte, sizeof(T)>>(value);
+}
+} // namespace
+
+TEST_SUITE("endian_integer<T, Order>" * doctest::description(""))
+{
+    TEST_CASE_TEMPLATE("layout ",
+                       Integer,
+                       ztd::v2::i8,
+                       ztd::v2::i16,
+                       ztd::v2::i32,
+                       ztd::v2::i64,
+                       ztd::v2::u8,
+                       ztd::v2::u16,
+                       ztd::v2::u32,
+                       ztd::v2::u64)
+    {
+        static_assert(sizeof(ztd::be<Integer>) == sizeof(Integer));
+        static_assert(alignof(ztd::be<Integer>) == alignof(Integer));
+        static_assert(std::is_trivially_copyable_v<ztd::be<Integer>>);
+        static_assert(std::is_standard_layout_v<ztd::le<Integer>>);
+
+        const auto values = {Integer(), Integer::MIN(), Integer::MAX(), Integer::MAX() / 3};
+        for (const auto value : values)
+        {
+            const ztd::be<Integer> big = value;
+            const ztd::le<Integer> little = value;
+            CHECK_EQ(big.value(), value);
+            CHECK_EQ(little.value(), value);
+            CHECK_EQ(Integer(big), value);
+            CHECK_EQ(big.data(), value.data());
+
+            if constexpr (std::endian::native == std::endian::little)
+            {
+                CHECK_EQ(little.raw(), value.data());
+                CHECK_EQ(big.raw(), value.swap_bytes().data());
+            }
+            else
+            {
+                CHECK_EQ(big.raw(), value.data());
+                CHECK_EQ(little.raw(), value.swap_bytes().data());
+            }
+        }
+    }
+
+    TEST_CASE("byte order")
+    {
+        const ztd::be<ztd::u32> big = 0x0102'0304_u32;
+        const ztd::le<ztd::u32> little = 0x0102'0304_u32;
+
+        CHECK_EQ(bytes(big), std::array{std::byte{1}, std::byte{2}, std::byte{3}, std::byte{4}});
+        CHECK_EQ(bytes(little), std::array{std::byte{4}, std::byte{3}, std::byte{2}, std::byte{1}});
+
+        CHECK_EQ(ztd::be<ztd::u16>::from_raw(std::bit_cast<std::uint16_t>(
+                     std::array{std::byte{0x12}, std::byte{0x34}})),
+                 0x1234_u16);
+
+        static_assert(ztd::be<ztd::u32>(7_u32).value() == 7_u32);
+    }
+
+    TEST_CASE("overlay")
+    {
+        // clang-format off
+        alignas(header) const std::array<unsigned char, sizeof(header)> wire{
+            0x00, 0x54,
+            0xab, 0xcd,
+            0xc0, 0xa8, 0x00, 0x01,
+            0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        };
+        // clang-format on
+
+        header h;
+        std::memcpy(&h, wire.data(), sizeof(h));
+        CHECK_EQ(h.length, 84_u16);
+        CHECK_EQ(h.id, 0xabcd_u16);
+        CHECK_EQ(h.source, 0xc0a8'0001_u32);
+        CHECK_EQ(h.extra, 42_u64);
+
+        h.length = 0x0102_u16;
+        std::array<unsigned char, sizeof(header)> out;
+        std::memcpy(out.data(), &h, sizeof(h));
+        CHECK_EQ(out[0], 0x01);
+        CHECK_EQ(out[1], 0x02);
+    }
+
+    TEST_CASE("comparison")
+    {
+        const ztd::be<ztd::i32> a = -5_i32;
+        const ztd::be<ztd::i32> b = 3_i32;
+        CHECK(a < b);
+        CHECK(a != b);
+        CHECK(a == ztd::be<ztd::i32>(-5_i32));
+    }
+}
@@ -0,0 +1,243 @@
+/**
+ * Copyright (C) 2025 Brandon Zorn <brandonzorn@cock.li>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <array>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+#include <doctest/doctest.h>
+
+#include "ztd/detail/types.hxx"
+
+namespace
+{
+template<typename T>
+T
+parse(const std::string_view s)
+{
+    T value;
+    const auto [ptr, ec] = from_chars(s.data(), s.data() + s.size(), value);
+    REQUIRE_EQ(ec, std::errc());
+    REQUIRE_EQ(ptr, s.data() + s.size());
+    return value;
+}
+
+template<typename T>
+std::string
+format(const T value)
+{
+    std::array<char, T::max_chars> buffer;
+    const auto [ptr, ec] = to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+    REQUIRE_EQ(ec, std::errc());
+    return std::string(buffer.data(), ptr);
+}
+} // namespace
+
+TEST_SUITE("basic_fixed<T, Radix, Digits>" * doctest::description(""))
+{
+    using money = ztd::decimal<ztd::i64, 2>;
+    using q16 = ztd::fixed<ztd::i32, 16>;
+
+    TEST_CASE("layout")
+    {
+        static_assert(sizeof(money) == sizeof(ztd::i64));
+        static_assert(std::is_trivially_copyable_v<money>);
+        static_assert(money::scale == 100);
+        static_assert(q16::scale == 65536);
+        static_assert(ztd::fixed<ztd::u16, 8>::scale == 256);
+    }
+
+    TEST_CASE("create")
+    {
+        CHECK_EQ(money(12_i64).raw(), 1200);
+        CHECK_EQ(money::from_raw(1250_i64).trunc(), 12);
+        CHECK_EQ(q16(3_i32).raw(), 3 * 65536);
+
+        CHECK_EQ(money::checked_create(ztd::i64::MAX()), std::nullopt);
+        CHECK_EQ(money::saturating_create(ztd::i64::MAX()), money::MAX());
+        CHECK_EQ(money::saturating_create(ztd::i64::MIN()), money::MIN());
+        CHECK_EQ(money::EPSILON().raw(), 1);
+    }
+
+    TEST_CASE("add sub")
+    {
+        const auto a = parse<money>("10.25");
+        const auto b = parse<money>("0.80");
+
+        CHECK_EQ(a + b, parse<money>("11.05"));
+        CHECK_EQ(a - b, parse<money>("9.45"));
+        CHECK_EQ(b - a, parse<money>("-9.45"));
+        CHECK_EQ(-a, parse<money>("-10.25"));
+
+        CHECK_EQ(money::MAX().checked_add(money::EPSILON()), std::nullopt);
+        CHECK_EQ(money::MAX().saturating_add(money::EPSILON()), money::MAX());
+        CHECK_EQ(money::MAX().wrapping_add(money::EPSILON()), money::MIN());
+    }
+
+    TEST_CASE("mul")
+    {
+        CHECK_EQ(parse<money>("1.50") * parse<money>("2.25"), parse<money>("3.38"));
+        CHECK_EQ(parse<money>("-1.50") * parse<money>("2.25"), parse<money>("-3.38"));
+
+        // ties to even
+        CHECK_EQ(parse<money>("0.05") * parse<money>("0.50"), parse<money>("0.02"));
+        CHECK_EQ(parse<money>("0.07") * parse<money>("0.50"), parse<money>("0.04"));
+        CHECK_EQ(parse<money>("-0.05") * parse<money>("0.50"), parse<money>("-0.02"));
+
+        CHECK_EQ(parse<q16>("1.5") * parse<q16>("-2.5"), parse<q16>("-3.75"));
+
+        // price * quantity is exact
+        CHECK_EQ(parse<money>("19.99") * 3_i64, parse<money>("59.97"));
+        CHECK_EQ(3_i64 * parse<money>("19.99"), parse<money>("59.97"));
+
+        // the intermediate product is wider than the type
+        const auto big = money(10'000'000'000_i64);
+        CHECK_EQ(big * parse<money>("0.5"), money(5'000'000'000_i64));
+        CHECK_EQ(big.checked_mul(big), std::nullopt);
+        CHECK_EQ(big.saturating_mul(big), money::MAX());
+        CHECK_EQ(big.saturating_mul(-big), money::MIN());
+    }
+
+    TEST_CASE("div")
+    {
+        CHECK_EQ(parse<money>("10.00") / parse<money>("3.00"), parse<money>("3.33"));
+        CHECK_EQ(parse<money>("20.00") / parse<money>("3.00"), parse<money>("6.67"));
+        CHECK_EQ(parse<money>("-20.00") / parse<money>("3.00"), parse<money>("-6.67"));
+        CHECK_EQ(parse<money>("20.00") / parse<money>("-3.00"), parse<money>("-6.67"));
+        CHECK_EQ(parse<money>("10.00") / 4_i64, parse<money>("2.50"));
+
+        // ties to even
+        CHECK_EQ(parse<money>("0.01") / parse<money>("2.00"), parse<money>("0.00"));
+        CHECK_EQ(parse<money>("0.03") / parse<money>("2.00"), parse<money>("0.02"));
+
+        CHECK_EQ(parse<q16>("1") / parse<q16>("8"), parse<q16>("0.125"));
+
+        CHECK_EQ(money(1_i64).checked_div(money()), std::nullopt);
+        CHECK_EQ(money::MAX().checked_div(money::EPSILON()), std::nullopt);
+        CHECK_EQ(money::MAX().saturating_div(money::EPSILON()), money::MAX());
+    }
+
+    TEST_CASE("div by integer")
+    {
+        // 10 does not fit at this scale, the raw value is divided instead
+        using nano = ztd::decimal<ztd::i64, 18>;
+
+        CHECK_EQ(parse<nano>("1") / 10_i64, parse<nano>("0.1"));
+        CHECK_EQ(nano::MAX() / 1'000'000_i64, nano::from_raw(9'223'372'036'855_i64));
+        CHECK_EQ(parse<nano>("1.5") / -3_i64, parse<nano>("-0.5"));
+        CHECK_EQ(nano::MIN() / 1_i64, nano::MIN());
+
+        auto value = parse<nano>("9");
+        value /= 1'000_i64;
+        CHECK_EQ(value, parse<nano>("0.009"));
+
+        // ties to even
+        CHECK_EQ(nano::from_raw(3_i64) / 2_i64, nano::from_raw(2_i64));
+        CHECK_EQ(nano::from_raw(5_i64) / 2_i64, nano::from_raw(2_i64));
+        CHECK_EQ(nano::from_raw(-5_i64) / 2_i64, nano::from_raw(-2_i64));
+    }
+
+    TEST_CASE("round")
+    {
+        CHECK_EQ(parse<money>("2.50").round(), 2);
+        CHECK_EQ(parse<money>("3.50").round(), 4);
+        CHECK_EQ(parse<money>("2.51").round(), 3);
+        CHECK_EQ(parse<money>("-2.51").round(), -3);
+        CHECK_EQ(parse<money>("-2.51").trunc(), -2);
+    }
+
+    TEST_CASE("to_chars")
+    {
+        CHECK_EQ(format(parse<money>("12.5")), "12.50");
+        CHECK_EQ(format(parse<money>("-0.05")), "-0.05");
+        CHECK_EQ(format(money()), "0.00");
+        CHECK_EQ(format(money::MIN()), "-92233720368547758.08");
+        CHECK_EQ(format(money::MAX()), "92233720368547758.07");
+
+        CHECK_EQ(format(q16(3_i32)), "3");
+        CHECK_EQ(format(parse<q16>("-0.375")), "-0.375");
+        CHECK_EQ(format(q16::EPSILON()), "0.0000152587890625");
+        CHECK_EQ(format(ztd::decimal<ztd::u32, 0>(7_u32)), "7");
+
+        std::array<char, 4> small;
+        CHECK_EQ(to_chars(small.data(), small.data() + small.size(), parse<money>("12.50")).ec,
+                 std::errc::value_too_large);
+    }
+
+    TEST_CASE("from_chars")
+    {
+        CHECK_EQ(parse<money>("12").raw(), 1200);
+        CHECK_EQ(parse<money>(".5").raw(), 50);
+        CHECK_EQ(parse<money>("5.").raw(), 500);
+        CHECK_EQ(parse<money>("1.005").raw(), 100);
+        CHECK_EQ(parse<money>("1.015").raw(), 102);
+        CHECK_EQ(parse<money>("1.0050000000000000000001").raw(), 101);
+        CHECK_EQ(parse<money>("92233720368547758.07"), money::MAX());
+        CHECK_EQ(parse<money>("-92233720368547758.08"), money::MIN());
+
+        // the digits past a decimal type are only a tie breaker
+        using atto = ztd::decimal<ztd::u64, 19>;
+        CHECK_EQ(parse<atto>("0.00000000000000000015").raw(), 2);
+        CHECK_EQ(parse<atto>("0.00000000000000000025").raw(), 2);
+        CHECK_EQ(parse<atto>("0.000000000000000000250001").raw(), 3);
+        CHECK_EQ(parse<atto>("0.00000000000000000026").raw(), 3);
+
+        // 2^-33 is 0.000000000116415321826934814453125, the midpoint between
+        // raw 0 and 1, so a value just above it has to look past the 18th digit
+        using q32 = ztd::fixed<ztd::i64, 32>;
+        CHECK_EQ(parse<q32>("0.0000000001164153219").raw(), 1);
+        CHECK_EQ(parse<q32>("0.0000000001164153218").raw(), 0);
+        CHECK_EQ(parse<q32>("0.000000000116415321826934814453125").raw(), 0);
+        CHECK_EQ(parse<q32>("0.0000000001164153218269348144531250001").raw(), 1);
+        CHECK_EQ(parse<q32>("-0.0000000001164153219").raw(), -1);
+        CHECK_EQ(parse<q32>("0.000000000349245965480804443359375").raw(), 2);
+
+        money value;
+        const std::string_view overflow = "92233720368547758.08";
+        CHECK_EQ(from_chars(overflow.data(), overflow.data() + overflow.size(), value).ec,
+                 std::errc::result_out_of_range);
+
+        for (const std::string_view bad : {"", "-", ".", "abc", "-.x"})
+        {
+            const auto [ptr, ec] = from_chars(bad.data(), bad.data() + bad.size(), value);
+            CHECK_EQ(ec, std::errc::invalid_argument);
+            CHECK_EQ(ptr, bad.data());
+        }
+
+        ztd::decimal<ztd::u32, 3> unsigned_value;
+        const std::string_view negative = "-1";
+        CHECK_EQ(from_chars(negative.data(), negative.data() + negative.size(), unsigned_value).ec,
+                 std::errc::invalid_argument);
+    }
+
+    TEST_CASE("round trip")
+    {
+        for (std::int32_t raw = -70000; raw <= 70000; raw += 7)
+        {
+            const auto value = q16::from_raw(ztd::i32(raw));
+            CHECK_EQ(parse<q16>(format(value)), value);
+        }
+    }
+
+    TEST_CASE("comparison")
+    {
+        CHECK(parse<money>("1.01") > parse<money>("1.00"));
+        CHECK(parse<money>("-1.01") < parse<money>("-1.00"));
+        CHECK(parse<money>("1.10") == parse<money>("1.1"));
+    }
+}
@@ -0,0 +1,212 @@
+/**
+ * Copyright (C) 2025 Brandon Zorn <brandonzorn@cock.li>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <span>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "ztd/detail/types.hxx"
+
+TEST_SUITE("std::span<integer<T>>" * doctest::description(""))
+{
+    TEST_CASE_TEMPLATE("wrapping ",
+                       Integer,
+                       ztd::v2::i8,
+                       ztd::v2::i16,
+                       ztd::v2::i32,
+                       ztd::v2::i64,
+                       ztd::v2::u8,
+                       ztd::v2::u16,
+                       ztd::v2::u32,
+                       ztd::v2::u64)
+    {
+        using type = typename Integer::integer_type;
+
+        // larger than a single block, and not a multiple of it
+        std::vector<Integer> lhs;
+        std::vector<Integer> rhs;
+        for (type i = 0; i < 100; ++i)
+        {
+            lhs.push_back(Integer(type(i % 50)));
+            rhs.push_back(Integer(type(i % 7)));
+        }
+        lhs[42] = Integer::MAX();
+
+        SUBCASE("add")
+        {
+            auto result = lhs;
+            ztd::wrapping_add(std::span(result), rhs);
+            for (std::size_t i = 0; i < result.size(); ++i)
+            {
+                CHECK_EQ(result[i], lhs[i].wrapping_add(rhs[i]));
+            }
+        }
+
+        SUBCASE("sub")
+        {
+            auto result = lhs;
+            ztd::wrapping_sub(std::span(result), rhs);
+            for (std::size_t i = 0; i < result.size(); ++i)
+            {
+                CHECK_EQ(result[i], lhs[i].wrapping_sub(rhs[i]));
+            }
+        }
+
+        SUBCASE("mul")
+        {
+            auto result = lhs;
+            ztd::wrapping_mul(std::span(result), rhs);
+            for (std::size_t i = 0; i < result.size(); ++i)
+            {
+                CHECK_EQ(result[i], lhs[i].wrapping_mul(rhs[i]));
+            }
+        }
+    }
+
+    TEST_CASE_TEMPLATE("saturating ",
+                       Integer,
+                       ztd::v2::i8,
+                       ztd::v2::i16,
+                       ztd::v2::i32,
+                       ztd::v2::i64,
+                       ztd::v2::u8,
+                       ztd::v2::u16,
+                       ztd::v2::u32,
+                       ztd::v2::u64)
+    {
+        const std::vector<Integer> values{
+            Integer::MIN(),
+            Integer::MAX(),
+            Integer::unchecked_create(0),
+            Integer::unchecked_create(1),
+            Integer::unchecked_create(2),
+            Integer::unchecked_create(100),
+        };
+
+        std::vector<Integer> lhs;
+        std::vector<Integer> rhs;
+        for (const auto x : values)
+        {
+            for (const auto y : values)
+            {
+                lhs.push_back(x);
+                rhs.push_back(y);
+            }
+        }
+
+        SUBCASE("add")
+        {
+            auto result = lhs;
+            ztd::saturating_add(std::span(result), rhs);
+            for (std::size_t i = 0; i < result.size(); ++i)
+            {
+                CHECK_EQ(result[i], lhs[i].saturating_add(rhs[i]));
+            }
+        }
+
+        SUBCASE("sub")
+        {
+            auto result = lhs;
+            ztd::saturating_sub(std::span(result), rhs);
+            for (std::size_t i = 0; i < result.size(); ++i)
+            {
+                CHECK_EQ(result[i], lhs[i].saturating_sub(rhs[i]));
+            }
+        }
+
+        SUBCASE("mul")
+        {
+            auto result = lhs;
+            ztd::saturating_mul(std::span(result), rhs);
+            for (std::size_t i = 0; i < result.size(); ++i)
+            {
+                CHECK_EQ(result[i], lhs[i].saturating_mul(rhs[i]));
+            }
+        }
+    }
+
+    TEST_CASE_TEMPLATE("checked ",
+                       Integer,
+                       ztd::v2::i8,
+                       ztd::v2::i16,
+                       ztd::v2::i32,
+                       ztd::v2::i64,
+                       ztd::v2::u8,
+                       ztd::v2::u16,
+                       ztd::v2::u32,
+                       ztd::v2::u64)
+    {
+        using type = typename Integer::integer_type;
+
+        std::vector<Integer> lhs(150, Integer(type(3)));
+        const std::vector<Integer> rhs(150, Integer(type(2)));
+
+        SUBCASE("no overflow")
+        {
+            auto result = lhs;
+            REQUIRE(ztd::checked_add(std::span(result), rhs).has_value());
+            CHECK(std::ranges::all_of(result, [](auto x) { return x == 5; }));
+
+            result = lhs;
+            REQUIRE(ztd::checked_sub(std::span(result), rhs).has_value());
+            CHECK(std::ranges::all_of(result, [](auto x) { return x == 1; }));
+
+            result = lhs;
+            REQUIRE(ztd::checked_mul(std::span(result), rhs).has_value());
+            CHECK(std::ranges::all_of(result, [](auto x) { return x == 6; }));
+        }
+
+        SUBCASE("overflow add")
+        {
+            lhs[70] = Integer::MAX();
+            lhs[120] = Integer::MAX();
+
+            auto result = lhs;
+            const auto e = ztd::checked_add(std::span(result), rhs);
+            REQUIRE(!e.has_value());
+            CHECK_EQ(e.error(), 70);
+            CHECK_EQ(result[69], 5);
+            CHECK_EQ(result[70], Integer::MAX());
+            CHECK_EQ(result[71], 3);
+        }
+
+        SUBCASE("overflow sub")
+        {
+            lhs[3] = Integer::MIN();
+
+            auto result = lhs;
+            const auto e = ztd::checked_sub(std::span(result), rhs);
+            REQUIRE(!e.has_value());
+            CHECK_EQ(e.error(), 3);
+            CHECK_EQ(result[2], 1);
+            CHECK_EQ(result[3], Integer::MIN());
+        }
+
+        SUBCASE("overflow mul")
+        {
+            lhs[149] = Integer::MAX();
+
+            auto result = lhs;
+            const auto e = ztd::checked_mul(std::span(result), rhs);
+            REQUIRE(!e.has_value());
+            CHECK_EQ(e.error(), 149);
+            CHECK_EQ(result[148], 6);
+        }
+    }
+}
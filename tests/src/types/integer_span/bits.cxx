@@ -0,0 +1,161 @@
+/**
+ * Copyright (C) 2025 Brandon Zorn <brandonzorn@cock.li>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <optional>
+#include <span>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "ztd/detail/types.hxx"
+
+TEST_SUITE("std::span<integer<T>>" * doctest::description(""))
+{
+    TEST_CASE_TEMPLATE("count_ones ",
+                       Integer,
+                       ztd::v2::i8,
+                       ztd::v2::i16,
+                       ztd::v2::i32,
+                       ztd::v2::i64,
+                       ztd::v2::u8,
+                       ztd::v2::u16,
+                       ztd::v2::u32,
+                       ztd::v2::u64)
+    {
+        using type = typename Integer::integer_type;
+
+        const std::vector<Integer> empty;
+        CHECK_EQ(ztd::count_ones(std::span(empty)), 0);
+
+        // more than one block of words
+        std::vector<Integer> values;
+        std::size_t expected = 0;
+        for (int i = 0; i < 1000; ++i)
+        {
+            const auto value = Integer::unchecked_create(type(i * 37 + i / 3));
+            values.push_back(value);
+            expected += value.count_ones().data();
+        }
+        values.push_back(Integer::MIN());
+        values.push_back(Integer::MAX());
+        expected += Integer::MIN().count_ones().data() + Integer::MAX().count_ones().data();
+
+        CHECK_EQ(ztd::count_ones(std::span(values)), expected);
+
+        const std::vector<Integer> full(100, Integer::unchecked_create(type(-1)));
+        CHECK_EQ(ztd::count_ones(std::span(full)), 100 * Integer::BITS().data());
+    }
+
+    TEST_CASE_TEMPLATE("find set ",
+                       Integer,
+                       ztd::v2::i8,
+                       ztd::v2::i16,
+                       ztd::v2::i32,
+                       ztd::v2::i64,
+                       ztd::v2::u8,
+                       ztd::v2::u16,
+                       ztd::v2::u32,
+                       ztd::v2::u64)
+    {
+        using type = typename Integer::integer_type;
+
+        const std::size_t bits = Integer::BITS().data();
+
+        std::vector<Integer> bitmap(200, Integer(type(0)));
+        CHECK_EQ(ztd::find_first_set(std::span(bitmap)), std::nullopt);
+        CHECK_EQ(ztd::find_first_unset(std::span(bitmap)), 0);
+
+        // past the first block
+        bitmap[150] = Integer(type(1)).rotate_right(1_i32);
+        bitmap[151] = Integer(type(5));
+        CHECK_EQ(ztd::find_first_set(std::span(bitmap)), 150 * bits + bits - 1);
+        CHECK_EQ(ztd::find_next_set(std::span(bitmap), 150 * bits + bits), 151 * bits);
+        CHECK_EQ(ztd::find_next_set(std::span(bitmap), 151 * bits + 1), 151 * bits + 2);
+        CHECK_EQ(ztd::find_next_set(std::span(bitmap), 151 * bits + 3), std::nullopt);
+        CHECK_EQ(ztd::find_next_set(std::span(bitmap), 200 * bits), std::nullopt);
+
+        // a free space bitmap
+        std::vector<Integer> used(100, Integer::unchecked_create(type(-1)));
+        CHECK_EQ(ztd::find_first_unset(std::span(used)), std::nullopt);
+        used[70] = Integer::unchecked_create(type(~type(8)));
+        CHECK_EQ(ztd::find_first_unset(std::span(used)), 70 * bits + 3);
+        CHECK_EQ(ztd::find_next_unset(std::span(used), 70 * bits + 3), 70 * bits + 3);
+        CHECK_EQ(ztd::find_next_unset(std::span(used), 70 * bits + 4), std::nullopt);
+
+        // every set bit is found in order
+        std::vector<Integer> sparse(20, Integer(type(0)));
+        std::vector<std::size_t> expected;
+        for (std::size_t i = 3; i < 20 * bits; i += 7)
+        {
+            const auto word = std::size_t(i / bits);
+            sparse[word] = Integer::unchecked_create(
+                type(sparse[word].data() | type(type(1) << (i % bits))));
+            expected.push_back(i);
+        }
+
+        std::vector<std::size_t> found;
+        for (auto i = ztd::find_first_set(std::span(sparse)); i;
+             i = ztd::find_next_set(std::span(sparse), *i + 1))
+        {
+            found.push_back(*i);
+        }
+        CHECK_EQ(found, expected);
+    }
+
+    TEST_CASE_TEMPLATE("swap_bytes rotate ",
+                       Integer,
+                       ztd::v2::i8,
+                       ztd::v2::i16,
+                       ztd::v2::i32,
+                       ztd::v2::i64,
+                       ztd::v2::u8,
+                       ztd::v2::u16,
+                       ztd::v2::u32,
+                       ztd::v2::u64)
+    {
+        using type = typename Integer::integer_type;
+
+        std::vector<Integer> values;
+        for (int i = 0; i < 100; ++i)
+        {
+            values.push_back(Integer::unchecked_create(type(i * 0x01020305 + 7)));
+        }
+        values.push_back(Integer::MIN());
+        values.push_back(Integer::MAX());
+
+        auto swapped = values;
+        ztd::swap_bytes(std::span(swapped));
+        for (std::size_t i = 0; i < values.size(); ++i)
+        {
+            CHECK_EQ(swapped[i], values[i].swap_bytes());
+        }
+
+        for (const std::int32_t n : {0, 1, 3, 8, 63, 64, 65, -1, -9})
+        {
+            auto left = values;
+            auto right = values;
+            ztd::rotate_left(std::span(left), ztd::i32(n));
+            ztd::rotate_right(std::span(right), ztd::i32(n));
+            for (std::size_t i = 0; i < values.size(); ++i)
+            {
+                CHECK_EQ(left[i], values[i].rotate_left(ztd::i32(n)));
+                CHECK_EQ(right[i], values[i].rotate_right(ztd::i32(n)));
+            }
+        }
+    }
+}
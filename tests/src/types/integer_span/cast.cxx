@@ -0,0 +1,140 @@
+/**
+ * Copyright (C) 2025 Brandon Zorn <brandonzorn@cock.li>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <span>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "ztd/detail/types.hxx"
+
+namespace
+{
+// interesting values of From, and a few that are in range of any type
+template<typename From>
+std::vector<From>
+cast_values()
+{
+    using type = typename From::integer_type;
+
+    std::vector<From> values;
+    for (int i = 0; i < 100; ++i)
+    {
+        values.push_back(From(type(i)));
+    }
+    values.push_back(From::MIN());
+    values.push_back(From::MAX());
+    values.push_back(From::MIN() / From(type(2)));
+    values.push_back(From::MAX() / From(type(2)));
+    if constexpr (ztd::is_signed_integer<From>)
+    {
+        values.push_back(From(type(-1)));
+        values.push_back(From(type(-100)));
+    }
+    return values;
+}
+} // namespace
+
+TEST_SUITE("std::span<integer<T>>" * doctest::description(""))
+{
+    TEST_CASE_TEMPLATE("cast from ",
+                       From,
+                       ztd::v2::i8,
+                       ztd::v2::i16,
+                       ztd::v2::i32,
+                       ztd::v2::i64,
+                       ztd::v2::u8,
+                       ztd::v2::u16,
+                       ztd::v2::u32,
+                       ztd::v2::u64)
+    {
+        const auto src = cast_values<From>();
+
+        const auto check = [&]<typename To>()
+        {
+            std::vector<To> dst(src.size());
+
+            ztd::unchecked_cast(std::span(dst), std::span(src));
+            for (std::size_t i = 0; i < src.size(); ++i)
+            {
+                CHECK_EQ(dst[i], To::unchecked_create(src[i].data()));
+            }
+
+            ztd::saturating_cast(std::span(dst), std::span(src));
+            for (std::size_t i = 0; i < src.size(); ++i)
+            {
+                CHECK_EQ(dst[i], To::saturating_create(src[i].data()));
+            }
+
+            std::vector<To> checked(src.size());
+            const auto r = ztd::checked_cast(std::span(checked), std::span(src));
+
+            std::size_t first = src.size();
+            for (std::size_t i = 0; i < src.size(); ++i)
+            {
+                if (!To::checked_create(src[i].data()))
+                {
+                    first = i;
+                    break;
+                }
+            }
+
+            if (first == src.size())
+            {
+                CHECK(r.has_value());
+            }
+            else
+            {
+                REQUIRE(!r.has_value());
+                CHECK_EQ(r.error(), first);
+            }
+            for (std::size_t i = 0; i < first; ++i)
+            {
+                CHECK_EQ(checked[i], src[i].data());
+            }
+            for (std::size_t i = first; i < src.size(); ++i)
+            {
+                CHECK_EQ(checked[i], 0);
+            }
+        };
+
+        check.template operator()<ztd::i8>();
+        check.template operator()<ztd::i16>();
+        check.template operator()<ztd::i32>();
+        check.template operator()<ztd::i64>();
+        check.template operator()<ztd::u8>();
+        check.template operator()<ztd::u16>();
+        check.template operator()<ztd::u32>();
+        check.template operator()<ztd::u64>();
+    }
+
+    TEST_CASE("checked cast blocks")
+    {
+        // the failure is past the first block
+        std::vector<ztd::u64> src(300, 7_u64);
+        src[200] = 1'000_u64;
+        src[250] = 2'000_u64;
+
+        std::vector<ztd::u8> dst(src.size());
+        const auto r = ztd::checked_cast(std::span(dst), std::span(src));
+        REQUIRE(!r.has_value());
+        CHECK_EQ(r.error(), 200);
+        CHECK_EQ(dst[199], 7);
+        CHECK_EQ(dst[200], 0);
+        CHECK_EQ(dst[201], 0);
+    }
+}
@@ -0,0 +1,117 @@
+/**
+ * Copyright (C) 2025 Brandon Zorn <brandonzorn@cock.li>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "ztd/detail/types.hxx"
+
+TEST_SUITE("std::span<integer<T>>" * doctest::description(""))
+{
+    TEST_CASE_TEMPLATE("layout ",
+                       Integer,
+                       ztd::v2::i8,
+                       ztd::v2::i16,
+                       ztd::v2::i32,
+                       ztd::v2::i64,
+                       ztd::v2::isize,
+                       ztd::v2::u8,
+                       ztd::v2::u16,
+                       ztd::v2::u32,
+                       ztd::v2::u64,
+                       ztd::v2::usize)
+    {
+        using type = typename Integer::integer_type;
+
+        static_assert(std::is_standard_layout_v<Integer>);
+        static_assert(std::is_trivially_copyable_v<Integer>);
+        static_assert(sizeof(Integer) == sizeof(type));
+        static_assert(alignof(Integer) == alignof(type));
+
+        SUBCASE("bit_cast")
+        {
+            for (const auto x :
+                 {Integer::MIN(), Integer::MAX(), Integer(type(0)), Integer(type(42))})
+            {
+                const auto raw = std::bit_cast<type>(x);
+                CHECK_EQ(raw, x.data());
+                CHECK_EQ(std::bit_cast<Integer>(raw), x);
+            }
+        }
+
+        SUBCASE("as_integers")
+        {
+            std::vector<type> raw{type(1), type(2), type(3), std::numeric_limits<type>::max()};
+
+            const auto view = ztd::as_integers<Integer>(std::span(raw));
+            REQUIRE(std::same_as<typename decltype(view)::element_type, Integer>);
+            REQUIRE_EQ(view.size(), raw.size());
+            CHECK_EQ(static_cast<const void*>(view.data()), static_cast<const void*>(raw.data()));
+            CHECK_EQ(view[0], Integer(type(1)));
+            CHECK_EQ(view[3], Integer::MAX());
+
+            // writes go through to the raw buffer
+            view[1] = Integer(type(20));
+            CHECK_EQ(raw[1], type(20));
+        }
+
+        SUBCASE("as_integers const")
+        {
+            const std::array<type, 3> raw{type(1), type(2), type(3)};
+
+            const auto view = ztd::as_integers<Integer>(std::span(raw));
+            REQUIRE(std::same_as<typename decltype(view)::element_type, const Integer>);
+            REQUIRE_EQ(view.extent, 3);
+            CHECK_EQ(view[2], Integer(type(3)));
+        }
+
+        SUBCASE("as_raw")
+        {
+            std::vector<Integer> integers{Integer(type(1)), Integer::MIN(), Integer::MAX()};
+
+            const auto view = ztd::as_raw(std::span(integers));
+            REQUIRE(std::same_as<typename decltype(view)::element_type, type>);
+            REQUIRE_EQ(view.size(), integers.size());
+            CHECK_EQ(view[1], std::numeric_limits<type>::min());
+            CHECK_EQ(view[2], std::numeric_limits<type>::max());
+
+            view[0] = type(10);
+            CHECK_EQ(integers[0], Integer(type(10)));
+
+            const auto const_view = ztd::as_raw(std::span<const Integer>(integers));
+            REQUIRE(std::same_as<typename decltype(const_view)::element_type, const type>);
+            CHECK_EQ(const_view[0], type(10));
+        }
+
+        SUBCASE("round trip")
+        {
+            std::vector<type> raw{type(5), type(6), type(7)};
+
+            const auto back = ztd::as_raw(ztd::as_integers<Integer>(std::span(raw)));
+            CHECK_EQ(static_cast<const void*>(back.data()), static_cast<const void*>(raw.data()));
+            CHECK(std::ranges::equal(back, raw));
+        }
+    }
+}
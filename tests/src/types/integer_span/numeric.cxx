@@ -0,0 +1,182 @@
+/**
+ * Copyright (C) 2025 Brandon Zorn <brandonzorn@cock.li>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <span>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "ztd/detail/types.hxx"
+
+TEST_SUITE("std::span<integer<T>>" * doctest::description(""))
+{
+    TEST_CASE_TEMPLATE("sum ",
+                       Integer,
+                       ztd::v2::i8,
+                       ztd::v2::i16,
+                       ztd::v2::i32,
+                       ztd::v2::i64,
+                       ztd::v2::u8,
+                       ztd::v2::u16,
+                       ztd::v2::u32,
+                       ztd::v2::u64)
+    {
+        using type = typename Integer::integer_type;
+
+        SUBCASE("empty")
+        {
+            const std::vector<Integer> values;
+            CHECK_EQ(ztd::checked_sum(std::span(values)), Integer(type(0)));
+            CHECK_EQ(ztd::saturating_sum(std::span(values)), 0);
+            CHECK_EQ(ztd::checked_mean(std::span(values)), std::nullopt);
+        }
+
+        SUBCASE("fits")
+        {
+            std::vector<Integer> values;
+            for (int i = 0; i < 50; ++i)
+            {
+                values.push_back(Integer(type(i % 5)));
+            }
+            CHECK_EQ(ztd::checked_sum(std::span(values)), Integer(type(100)));
+            CHECK_EQ(ztd::checked_mean(std::span(values)), Integer(type(2)));
+        }
+
+        SUBCASE("overflow")
+        {
+            const std::vector<Integer> values{Integer::MAX(), Integer::MAX(), Integer(type(1))};
+            CHECK_EQ(ztd::checked_sum(std::span(values)), std::nullopt);
+            CHECK_EQ(ztd::saturating_sum(std::span(values)), Integer::MAX());
+            CHECK_EQ(ztd::checked_mean(std::span(values)),
+                     Integer::MAX() - Integer::MAX() / Integer(type(3)));
+        }
+
+        if constexpr (ztd::is_signed_integer<Integer>)
+        {
+            SUBCASE("intermediate overflow")
+            {
+                // only the final sum has to fit
+                const std::vector<Integer> values{Integer::MAX(), Integer(type(1)), Integer::MIN()};
+                CHECK_EQ(ztd::checked_sum(std::span(values)), Integer(type(0)));
+            }
+
+            SUBCASE("underflow")
+            {
+                const std::vector<Integer> values(3, Integer::MIN());
+                CHECK_EQ(ztd::checked_sum(std::span(values)), std::nullopt);
+                CHECK_EQ(ztd::saturating_sum(std::span(values)), Integer::MIN());
+                CHECK_EQ(ztd::checked_mean(std::span(values)), Integer::MIN());
+            }
+
+            SUBCASE("mean rounds towards zero")
+            {
+                const std::vector<Integer> values{Integer(type(-3)), Integer(type(-4))};
+                CHECK_EQ(ztd::checked_mean(std::span(values)), Integer(type(-3)));
+            }
+        }
+    }
+
+    TEST_CASE("sum blocks")
+    {
+        // more than one block, so the lanes are folded more than once
+        const std::vector<ztd::u64> values(200'000, ztd::u64::MAX() / 200'000_u64);
+        CHECK_EQ(ztd::checked_sum(std::span(values)),
+                 ztd::u64::MAX() / 200'000_u64 * 200'000_u64);
+
+        const std::vector<ztd::i64> negative(200'000, ztd::i64::MIN() / 200'000_i64);
+        CHECK_EQ(ztd::checked_sum(std::span(negative)),
+                 ztd::i64::MIN() / 200'000_i64 * 200'000_i64);
+        CHECK_EQ(ztd::checked_mean(std::span(negative)), ztd::i64::MIN() / 200'000_i64);
+    }
+
+    TEST_CASE_TEMPLATE("product ",
+                       Integer,
+                       ztd::v2::i8,
+                       ztd::v2::i16,
+                       ztd::v2::i32,
+                       ztd::v2::i64,
+                       ztd::v2::u8,
+                       ztd::v2::u16,
+                       ztd::v2::u32,
+                       ztd::v2::u64)
+    {
+        using type = typename Integer::integer_type;
+
+        const std::vector<Integer> empty;
+        CHECK_EQ(ztd::checked_product(std::span(empty)), Integer(type(1)));
+
+        const std::vector<Integer> small{Integer(type(2)), Integer(type(3)), Integer(type(7))};
+        CHECK_EQ(ztd::checked_product(std::span(small)), Integer(type(42)));
+
+        std::vector<Integer> big(100, Integer(type(2)));
+        CHECK_EQ(ztd::checked_product(std::span(big)), std::nullopt);
+
+        // a zero anywhere makes the product fit, even after an overflow
+        big[90] = Integer(type(0));
+        CHECK_EQ(ztd::checked_product(std::span(big)), Integer(type(0)));
+    }
+
+    TEST_CASE("product of an intermediate overflow")
+    {
+        // 64 * 2 does not fit, the final -128 does
+        const std::vector<ztd::i8> values{64_i8, 2_i8, -1_i8};
+        CHECK_EQ(ztd::checked_product(std::span(values)), ztd::i8::MIN());
+        CHECK_EQ(ztd::parallel_checked_product(std::span(values)), ztd::i8::MIN());
+
+        const std::vector<ztd::i8> positive{64_i8, 2_i8, 1_i8};
+        CHECK_EQ(ztd::checked_product(std::span(positive)), std::nullopt);
+
+        const std::vector<ztd::i64> min{ztd::i64::MIN(), -1_i64};
+        CHECK_EQ(ztd::checked_product(std::span(min)), std::nullopt);
+
+        // -1 * 2^62 * 2 = MIN, split over threads
+        std::vector<ztd::i64> split(1'000'000, 1_i64);
+        split.front() = -1_i64;
+        split[500'000] = 4'611'686'018'427'387'904_i64;
+        split.back() = 2_i64;
+        CHECK_EQ(ztd::parallel_checked_product(std::span(split), 4), ztd::i64::MIN());
+    }
+
+    TEST_CASE("parallel")
+    {
+        std::vector<ztd::u64> values;
+        for (std::uint64_t i = 0; i < 1'000'003; ++i)
+        {
+            values.push_back(ztd::u64(i));
+        }
+        const auto sum = 1'000'002_u64 * 1'000'003_u64 / 2_u64;
+
+        for (const std::size_t threads : {0uz, 1uz, 2uz, 3uz, 8uz})
+        {
+            CHECK_EQ(ztd::parallel_checked_sum(std::span(values), threads), sum);
+            CHECK_EQ(ztd::parallel_saturating_sum(std::span(values), threads), sum);
+            CHECK_EQ(ztd::parallel_checked_mean(std::span(values), threads), 500'001_u64);
+            CHECK_EQ(ztd::parallel_checked_product(std::span(values), threads), 0_u64);
+        }
+
+        values.push_back(ztd::u64::MAX());
+        CHECK_EQ(ztd::parallel_checked_sum(std::span(values)), std::nullopt);
+        CHECK_EQ(ztd::parallel_saturating_sum(std::span(values)), ztd::u64::MAX());
+
+        const std::vector<ztd::i32> twos(1'000'000, 2_i32);
+        CHECK_EQ(ztd::parallel_checked_product(std::span(twos), 4), std::nullopt);
+
+        const std::vector<ztd::i32> ones(1'000'000, -1_i32);
+        CHECK_EQ(ztd::parallel_checked_product(std::span(ones), 4), 1_i32);
+        CHECK_EQ(ztd::parallel_checked_sum(std::span(ones), 4), -1'000'000_i32);
+    }
+}
@@ -0,0 +1,161 @@
+/**
+ * Copyright (C) 2025 Brandon Zorn <brandonzorn@cock.li>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "ztd/detail/types.hxx"
+
+TEST_SUITE("std::span<integer<T>>" * doctest::description(""))
+{
+    TEST_CASE_TEMPLATE("fill_random ",
+                       Integer,
+                       ztd::v2::i8,
+                       ztd::v2::i16,
+                       ztd::v2::i32,
+                       ztd::v2::i64,
+                       ztd::v2::u8,
+                       ztd::v2::u16,
+                       ztd::v2::u32,
+                       ztd::v2::u64)
+    {
+        using type = typename Integer::integer_type;
+
+        SUBCASE("range")
+        {
+            // every odd length, so that the partial draws are covered
+            for (std::size_t size = 0; size < 20; ++size)
+            {
+                std::vector<Integer> values(size);
+                const auto min = Integer(type(3));
+                const auto max = Integer(type(9));
+                ztd::fill_random(std::span(values), min, max);
+                for (const auto value : values)
+                {
+                    CHECK(value >= min);
+                    CHECK(value <= max);
+                }
+            }
+        }
+
+        SUBCASE("every value")
+        {
+            std::vector<Integer> values(1'000);
+            const auto min = std::is_signed_v<type> ? Integer(type(-2)) : Integer(type(0));
+            const auto max = Integer(type(2));
+            ztd::fill_random(std::span(values), min, max);
+
+            for (auto value = min; value <= max; value += Integer(type(1)))
+            {
+                CHECK(std::ranges::find(values, value) != values.end());
+            }
+        }
+
+        SUBCASE("single value")
+        {
+            std::vector<Integer> values(100);
+            ztd::fill_random(std::span(values), Integer::MAX(), Integer::MAX());
+            CHECK(std::ranges::all_of(values, [](const auto v) { return v == Integer::MAX(); }));
+        }
+
+        SUBCASE("whole range")
+        {
+            const auto differs = [](const auto& values)
+            {
+                const auto first = values.front();
+                return std::ranges::any_of(values, [&](const auto v) { return v != first; });
+            };
+
+            std::vector<Integer> values(1'000);
+            ztd::fill_random(std::span(values));
+            CHECK(differs(values));
+            CHECK(std::ranges::any_of(values, [](const auto v) { return v.count_ones() > 1; }));
+
+            ztd::fill_random(std::span(values), Integer::MIN(), Integer::MAX());
+            CHECK(differs(values));
+        }
+
+        SUBCASE("seeded")
+        {
+            std::vector<Integer> a(101);
+            std::vector<Integer> b(101);
+
+            ztd::xoshiro256pp ea(9);
+            ztd::xoshiro256pp eb(9);
+            ztd::fill_random(std::span(a), Integer::MIN(), Integer(type(100)), ea);
+            ztd::fill_random(std::span(b), Integer::MIN(), Integer(type(100)), eb);
+            CHECK_EQ(a, b);
+
+            ztd::wyrand wa(9);
+            ztd::wyrand wb(9);
+            ztd::fill_random(std::span(a), wa);
+            ztd::fill_random(std::span(b), wb);
+            CHECK_EQ(a, b);
+        }
+    }
+
+    TEST_CASE("fill_random uniform")
+    {
+        // a large range that is not a power of two, where a plain modulo
+        // would bias the low values
+        constexpr std::uint32_t buckets = 10;
+        const auto max = ztd::u32((std::uint32_t(1) << 31) + (std::uint32_t(1) << 30) - 1);
+
+        std::vector<ztd::u32> values(100'000);
+        ztd::pcg64 engine(11);
+        ztd::fill_random(std::span(values), 0_u32, max, engine);
+
+        std::vector<std::int32_t> counts(buckets);
+        for (const auto value : values)
+        {
+            const auto bucket =
+                std::uint64_t(value.data()) * buckets / (std::uint64_t(max.data()) + 1);
+            counts[std::size_t(bucket)]++;
+        }
+        for (const auto count : counts)
+        {
+            CHECK(count > 9'500);
+            CHECK(count < 10'500);
+        }
+    }
+
+    TEST_CASE("random")
+    {
+        for (auto i = 0; i < 100; ++i)
+        {
+            const auto value = ztd::i8::random(-3_i8, 3_i8);
+            CHECK(value >= -3_i8);
+            CHECK(value <= 3_i8);
+        }
+        (void)ztd::u64::random();
+
+        ztd::random_context a(3);
+        ztd::random_context b(3);
+        CHECK_EQ(ztd::u64::random(a), ztd::u64::random(b));
+        CHECK_EQ(ztd::i16::random(a, -10_i16, 10_i16), ztd::i16::random(b, -10_i16, 10_i16));
+
+        std::vector<ztd::i32> x(50);
+        std::vector<ztd::i32> y(50);
+        ztd::fill_random(std::span(x), -100_i32, 100_i32, a);
+        ztd::fill_random(std::span(y), -100_i32, 100_i32, b);
+        CHECK_EQ(x, y);
+    }
+}
@@ -0,0 +1,145 @@
+/**
+ * Copyright (C) 2025 Brandon Zorn <brandonzorn@cock.li>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <cstdint>
+#include <random>
+#include <span>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "ztd/detail/types.hxx"
+
+namespace
+{
+template<typename Integer>
+std::vector<Integer>
+random_values(const std::size_t count, const std::uint32_t bits, const std::uint64_t seed)
+{
+    using type = typename Integer::integer_type;
+
+    std::mt19937_64 rng(seed);
+    std::vector<Integer> values;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const auto raw = bits == 0 ? 0 : rng() >> (64 - bits);
+        values.push_back(Integer::unchecked_create(type(raw)));
+    }
+    return values;
+}
+
+template<typename Packed>
+void
+check_round_trip(const std::vector<typename Packed::value_type>& values)
+{
+    const auto packed = Packed::encode(values);
+    REQUIRE_EQ(packed.size(), values.size());
+    CHECK_EQ(packed.decode(), values);
+
+    for (std::size_t i = 0; i < values.size(); i += 61)
+    {
+        CHECK_EQ(packed.at(i), values[i]);
+    }
+}
+} // namespace
+
+TEST_SUITE("packed_integers<T, Mode>" * doctest::description(""))
+{
+    TEST_CASE_TEMPLATE("round trip ",
+                       Integer,
+                       ztd::v2::i8,
+                       ztd::v2::i16,
+                       ztd::v2::i32,
+                       ztd::v2::i64,
+                       ztd::v2::u8,
+                       ztd::v2::u16,
+                       ztd::v2::u32,
+                       ztd::v2::u64)
+    {
+        using frame = ztd::packed_integers<Integer, ztd::packing::frame_of_reference>;
+        using delta = ztd::packed_integers<Integer, ztd::packing::delta>;
+
+        // every width, with partial blocks
+        for (std::uint32_t bits = 0; bits <= Integer::BITS().data(); ++bits)
+        {
+            const auto values = random_values<Integer>(300 + bits, bits, bits);
+            check_round_trip<frame>(values);
+            check_round_trip<delta>(values);
+        }
+
+        const std::vector<Integer> extremes{Integer::MIN(), Integer::MAX(), Integer::MIN()};
+        check_round_trip<frame>(extremes);
+        check_round_trip<delta>(extremes);
+
+        check_round_trip<frame>({});
+        check_round_trip<delta>({});
+    }
+
+    TEST_CASE("monotonic")
+    {
+        // a timestamp column, one entry about every second
+        std::vector<ztd::u64> timestamps;
+        std::mt19937_64 rng(7);
+        std::uint64_t now = 1'700'000'000'000;
+        for (std::size_t i = 0; i < 10'000; ++i)
+        {
+            now += 1000 + rng() % 16;
+            timestamps.push_back(ztd::u64(now));
+        }
+
+        const auto delta = ztd::packed_integers<ztd::u64, ztd::packing::delta>::encode(timestamps);
+        CHECK_EQ(delta.decode(), timestamps);
+        // 4 bits per value plus the block headers
+        CHECK_LT(delta.size_bytes(), timestamps.size() * sizeof(ztd::u64) / 10);
+
+        const auto frame = ztd::packed_integers<ztd::u64>::encode(timestamps);
+        CHECK_EQ(frame.decode(), timestamps);
+        CHECK_LT(frame.size_bytes(), timestamps.size() * sizeof(ztd::u64) / 3);
+        CHECK_LT(delta.size_bytes(), frame.size_bytes());
+
+        // a constant stride packs to nothing but the headers
+        std::vector<ztd::u32> stride;
+        for (std::uint32_t i = 0; i < 1024; ++i)
+        {
+            stride.push_back(ztd::u32(i * 4096));
+        }
+        const auto packed = ztd::packed_integers<ztd::u32, ztd::packing::delta>::encode(stride);
+        CHECK_EQ(packed.decode(), stride);
+        CHECK_LT(packed.size_bytes(), 8 * 32);
+    }
+
+    TEST_CASE("decode block")
+    {
+        std::vector<ztd::i32> values;
+        for (std::int32_t i = 0; i < 1000; ++i)
+        {
+            values.push_back(ztd::i32(i * 3 - 1500));
+        }
+        const auto packed = ztd::packed_integers<ztd::i32>::encode(values);
+        CHECK_EQ(packed.blocks(), 8);
+        CHECK_EQ(packed.block_length(0), 128);
+        CHECK_EQ(packed.block_length(7), 1000 - 7 * 128);
+
+        std::vector<ztd::i32> block(128);
+        CHECK_EQ(packed.decode_block(7, block), 1000 - 7 * 128);
+        for (std::size_t i = 0; i < 1000 - 7 * 128; ++i)
+        {
+            CHECK_EQ(block[i], values[7 * 128 + i]);
+        }
+    }
+}
@@ -0,0 +1,167 @@
+/**
+ * Copyright (C) 2025 Brandon Zorn <brandonzorn@cock.li>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <concepts>
+
+#include <doctest/doctest.h>
+
+#include "ztd/detail/types.hxx"
+
+TEST_SUITE("policy_integer<T, Policy>" * doctest::description(""))
+{
+    TEST_CASE("layout")
+    {
+        static_assert(sizeof(ztd::wrapping<ztd::u64>) == sizeof(ztd::u64));
+        static_assert(sizeof(ztd::saturating<ztd::i8>) == sizeof(ztd::i8));
+        static_assert(std::is_trivially_copyable_v<ztd::strict<ztd::u32>>);
+
+        // the result keeps the policy
+        static_assert(std::same_as<decltype(ztd::wrapping<ztd::u8>() + 1_u8),
+                                   ztd::wrapping<ztd::u8>>);
+        static_assert(std::same_as<decltype(1_u8 + ztd::saturating<ztd::u8>()),
+                                   ztd::saturating<ztd::u8>>);
+
+        // mixing policies has to be explicit
+        static_assert(!std::convertible_to<ztd::wrapping<ztd::u8>, ztd::saturating<ztd::u8>>);
+    }
+
+    TEST_CASE_TEMPLATE("wrapping ",
+                       Integer,
+                       ztd::v2::i8,
+                       ztd::v2::i16,
+                       ztd::v2::i32,
+                       ztd::v2::i64,
+                       ztd::v2::u8,
+                       ztd::v2::u16,
+                       ztd::v2::u32,
+                       ztd::v2::u64)
+    {
+        using type = typename Integer::integer_type;
+        using wrapping = ztd::wrapping<Integer>;
+
+        const wrapping max = Integer::MAX();
+        const wrapping min = Integer::MIN();
+
+        CHECK_EQ(max + wrapping(type(1)), min);
+        CHECK_EQ(min - wrapping(type(1)), max);
+        CHECK_EQ(max * wrapping(type(2)), Integer::MAX().wrapping_mul(Integer(type(2))));
+        CHECK_EQ(max + 1, min);
+        CHECK_EQ(1 + max, min);
+
+        auto x = max;
+        x += 1;
+        CHECK_EQ(x, min);
+        x -= 1;
+        CHECK_EQ(x, max);
+
+        CHECK_EQ(wrapping(type(7)) / wrapping(type(2)), 3);
+        CHECK_EQ(wrapping(type(7)) % wrapping(type(2)), 1);
+
+        if constexpr (ztd::is_signed_integer<Integer>)
+        {
+            CHECK_EQ(-min, min);
+            CHECK_EQ(min / wrapping(type(-1)), min);
+            CHECK_EQ(min % wrapping(type(-1)), 0);
+        }
+    }
+
+    TEST_CASE_TEMPLATE("saturating ",
+                       Integer,
+                       ztd::v2::i8,
+                       ztd::v2::i16,
+                       ztd::v2::i32,
+                       ztd::v2::i64,
+                       ztd::v2::u8,
+                       ztd::v2::u16,
+                       ztd::v2::u32,
+                       ztd::v2::u64)
+    {
+        using type = typename Integer::integer_type;
+        using saturating = ztd::saturating<Integer>;
+
+        const saturating max = Integer::MAX();
+        const saturating min = Integer::MIN();
+
+        CHECK_EQ(max + saturating(type(1)), max);
+        CHECK_EQ(min - saturating(type(1)), min);
+        CHECK_EQ(max * saturating(type(2)), max);
+        CHECK_EQ(max + 1, max);
+
+        auto x = max;
+        x *= 3;
+        CHECK_EQ(x, max);
+
+        if constexpr (ztd::is_signed_integer<Integer>)
+        {
+            CHECK_EQ(-min, max);
+            CHECK_EQ(min / saturating(type(-1)), max);
+            CHECK_EQ(min % saturating(type(-1)), 0);
+        }
+    }
+
+    TEST_CASE_TEMPLATE("strict ",
+                       Integer,
+                       ztd::v2::i8,
+                       ztd::v2::i16,
+                       ztd::v2::i32,
+                       ztd::v2::i64,
+                       ztd::v2::u8,
+                       ztd::v2::u16,
+                       ztd::v2::u32,
+                       ztd::v2::u64)
+    {
+        using type = typename Integer::integer_type;
+        using strict = ztd::strict<Integer>;
+
+        const strict a = Integer(type(100));
+        const strict b = Integer(type(7));
+
+        CHECK_EQ(a + b, 107);
+        CHECK_EQ(a - b, 93);
+        CHECK_EQ(b * b, 49);
+        CHECK_EQ(a / b, 14);
+        CHECK_EQ(a % b, 2);
+        CHECK_EQ((a + b).value(), Integer(type(107)));
+        CHECK_EQ((a + b).data(), type(107));
+    }
+
+    TEST_CASE("create")
+    {
+        // conversion from a raw integer follows the policy
+        CHECK_EQ(ztd::wrapping<ztd::u8>(300), 44);
+        CHECK_EQ(ztd::saturating<ztd::u8>(300), 255);
+        CHECK_EQ(ztd::saturating<ztd::i8>(-300), -128);
+        CHECK_EQ(ztd::strict<ztd::u8>(200), 200);
+
+        CHECK_EQ(ztd::wrapping<ztd::u8>(250_u8) + 10, 4);
+        CHECK_EQ(ztd::saturating<ztd::u8>(250_u8) + 10, 255);
+    }
+
+    TEST_CASE("comparison")
+    {
+        const ztd::wrapping<ztd::i32> a = 1_i32;
+        const ztd::wrapping<ztd::i32> b = 2_i32;
+
+        CHECK(a < b);
+        CHECK(b > a);
+        CHECK(a != b);
+        CHECK(a == 1_i32);
+        CHECK(a < 2u);
+        CHECK(-1 < a);
+        CHECK(a > -1);
+    }
+}
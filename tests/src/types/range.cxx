@@ -0,0 +1,138 @@
+/**
+ * Copyright (C) 2025 Brandon Zorn <brandonzorn@cock.li>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <ranges>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "ztd/detail/types.hxx"
+
+namespace
+{
+template<typename Tag>
+std::vector<ztd::integer<Tag>>
+collect(const ztd::range<Tag> r)
+{
+    std::vector<ztd::integer<Tag>> values;
+    for (const auto value : r)
+    {
+        values.push_back(value);
+    }
+    CHECK_EQ(values.size(), r.size());
+    return values;
+}
+} // namespace
+
+TEST_SUITE("range<T>" * doctest::description(""))
+{
+    TEST_CASE("concepts")
+    {
+        static_assert(std::ranges::random_access_range<ztd::range<ztd::detail::u64>>);
+        static_assert(std::ranges::sized_range<ztd::range<ztd::detail::u64>>);
+        static_assert(std::ranges::common_range<ztd::range<ztd::detail::u64>>);
+        static_assert(std::ranges::view<ztd::range<ztd::detail::i8>>);
+        static_assert(std::ranges::borrowed_range<ztd::range<ztd::detail::i8>>);
+        static_assert(std::random_access_iterator<ztd::range<ztd::detail::u8>::iterator>);
+    }
+
+    TEST_CASE("values")
+    {
+        CHECK_EQ(collect(ztd::range(5_u32)), std::vector{0_u32, 1_u32, 2_u32, 3_u32, 4_u32});
+        CHECK_EQ(collect(ztd::range(3_i32, 7_i32)), std::vector{3_i32, 4_i32, 5_i32, 6_i32});
+        CHECK_EQ(collect(ztd::range(0_u8, 250_u8, 100_u8)), std::vector{0_u8, 100_u8, 200_u8});
+        CHECK_EQ(collect(ztd::range(5_i32, -5_i32, -2_i32)),
+                 std::vector{5_i32, 3_i32, 1_i32, -1_i32, -3_i32});
+
+        CHECK(ztd::range(0_u32).empty());
+        CHECK(ztd::range(7_i32, 3_i32).empty());
+        CHECK(ztd::range(3_i32, 7_i32, -1_i32).empty());
+    }
+
+    TEST_CASE("bounds")
+    {
+        // the end bound and the step past the last value do not overflow
+        CHECK_EQ(ztd::range(ztd::u8::MIN(), ztd::u8::MAX()).size(), 255);
+        CHECK_EQ(collect(ztd::range(250_u8, ztd::u8::MAX(), 3_u8)),
+                 std::vector{250_u8, 253_u8});
+        CHECK_EQ(ztd::range(ztd::i8::MIN(), ztd::i8::MAX()).size(), 255);
+        CHECK_EQ(ztd::range(ztd::i8::MAX(), ztd::i8::MIN(), ztd::i8::MIN()).size(), 2);
+        CHECK_EQ(collect(ztd::range(ztd::i8::MAX(), ztd::i8::MIN(), ztd::i8::MIN())),
+                 std::vector{ztd::i8::MAX(), -1_i8});
+
+        const auto r = ztd::range(ztd::u64::MIN(), ztd::u64::MAX(), ztd::u64::MAX() / 4_u64);
+        CHECK_EQ(r.size(), 5);
+        CHECK_EQ(r.back(), ztd::u64::MAX() / 4_u64 * 4_u64);
+
+        CHECK_EQ(ztd::range(ztd::i64::MIN(), ztd::i64::MAX(), ztd::i64::MAX()).size(), 3);
+    }
+
+    TEST_CASE("random access")
+    {
+        const auto r = ztd::range(10_i64, 100_i64, 10_i64);
+        CHECK_EQ(r.size(), 9);
+        CHECK_EQ(r[3], 40_i64);
+        CHECK_EQ(r.front(), 10_i64);
+        CHECK_EQ(r.back(), 90_i64);
+        CHECK_EQ(*(r.begin() + 5), 60_i64);
+        CHECK_EQ(r.end() - r.begin(), 9);
+        CHECK_EQ(*std::ranges::find(r, 70_i64), 70_i64);
+
+        auto reversed = r | std::views::reverse;
+        CHECK_EQ(*reversed.begin(), 90_i64);
+    }
+
+    TEST_CASE("more elements than difference_type")
+    {
+        constexpr auto max = std::numeric_limits<std::int64_t>::max();
+
+        const auto r = ztd::range(ztd::u64::MAX());
+        CHECK_EQ(r.size(), std::numeric_limits<std::uint64_t>::max());
+
+        // the index goes past the difference_type max one step at a time
+        auto it = r.begin() + max;
+        it += max;
+        CHECK_EQ(*it, ztd::u64::MAX() - 1_u64);
+        CHECK_EQ(r.back(), ztd::u64::MAX() - 1_u64);
+        CHECK_EQ(std::next(it), r.end());
+
+        it -= max;
+        CHECK_EQ(*it, ztd::u64(std::uint64_t(max)));
+        CHECK_EQ(it - r.begin(), max);
+        CHECK_EQ(std::prev(r.end()) - it, max);
+    }
+
+    TEST_CASE("constexpr")
+    {
+        constexpr auto sum = []
+        {
+            auto total = 0_u32;
+            for (const auto i : ztd::range(1_u32, 101_u32))
+            {
+                total += i;
+            }
+            return total;
+        }();
+        static_assert(sum == 5050_u32);
+        static_assert(ztd::range(0_u16, 1000_u16, 7_u16).size() == 143);
+    }
+}
@@ -0,0 +1,199 @@
+/**
+ * Copyright (C) 2025 Brandon Zorn <brandonzorn@cock.li>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <array>
+#include <cstddef>
+#include <span>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "ztd/detail/types.hxx"
+
+namespace
+{
+template<typename... Ts>
+std::vector<std::byte>
+bytes(const Ts... values)
+{
+    return {std::byte(values)...};
+}
+
+// interesting values of Integer, around every encoded length
+template<typename Integer>
+std::vector<Integer>
+varint_values()
+{
+    using type = typename Integer::integer_type;
+    using unsigned_type = std::make_unsigned_t<type>;
+
+    std::vector<Integer> values{Integer::MIN(), Integer::MAX()};
+    for (std::uint32_t shift = 0; shift < Integer::BITS().data(); ++shift)
+    {
+        const auto bit = unsigned_type(unsigned_type(1) << shift);
+        values.push_back(Integer::unchecked_create(type(bit)));
+        values.push_back(Integer::unchecked_create(type(unsigned_type(bit - 1u))));
+        if constexpr (ztd::is_signed_integer<Integer>)
+        {
+            values.push_back(Integer::unchecked_create(type(unsigned_type(0u - bit))));
+        }
+    }
+    return values;
+}
+} // namespace
+
+TEST_SUITE("varint" * doctest::description(""))
+{
+    TEST_CASE("zigzag")
+    {
+        CHECK_EQ(ztd::zigzag_encode(0_i32), 0_u32);
+        CHECK_EQ(ztd::zigzag_encode(-1_i32), 1_u32);
+        CHECK_EQ(ztd::zigzag_encode(1_i32), 2_u32);
+        CHECK_EQ(ztd::zigzag_encode(-2_i32), 3_u32);
+        CHECK_EQ(ztd::zigzag_encode(ztd::i32::MAX()), ztd::u32::MAX() - 1_u32);
+        CHECK_EQ(ztd::zigzag_encode(ztd::i32::MIN()), ztd::u32::MAX());
+
+        for (int i = -128; i < 128; ++i)
+        {
+            const auto value = ztd::i8(std::int8_t(i));
+            CHECK_EQ(ztd::zigzag_decode(ztd::zigzag_encode(value)), value);
+        }
+    }
+
+    TEST_CASE("encoding")
+    {
+        std::array<std::byte, 10> buffer;
+        const auto encode = [&](const auto value)
+        {
+            const auto [ptr, ec] =
+                ztd::to_varint(buffer.data(), buffer.data() + buffer.size(), value);
+            REQUIRE_EQ(ec, std::errc());
+            return std::vector<std::byte>(buffer.data(), ptr);
+        };
+
+        CHECK_EQ(encode(0_u32), bytes(0x00));
+        CHECK_EQ(encode(127_u32), bytes(0x7f));
+        CHECK_EQ(encode(128_u32), bytes(0x80, 0x01));
+        CHECK_EQ(encode(300_u32), bytes(0xac, 0x02));
+        CHECK_EQ(encode(ztd::u8::MAX()), bytes(0xff, 0x01));
+        CHECK_EQ(encode(ztd::u32::MAX()), bytes(0xff, 0xff, 0xff, 0xff, 0x0f));
+        CHECK_EQ(encode(ztd::u64::MAX()),
+                 bytes(0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01));
+        CHECK_EQ(encode(-1_i64), bytes(0x01));
+        CHECK_EQ(encode(-65_i64), bytes(0x81, 0x01));
+
+        static_assert(ztd::varint_max_bytes<ztd::u8> == 2);
+        static_assert(ztd::varint_max_bytes<ztd::i32> == 5);
+        static_assert(ztd::varint_max_bytes<ztd::u64> == 10);
+
+        std::array<std::byte, 1> small;
+        CHECK_EQ(ztd::to_varint(small.data(), small.data() + small.size(), 300_u32).ec,
+                 std::errc::value_too_large);
+    }
+
+    TEST_CASE("decoding errors")
+    {
+        const auto decode = [](const std::vector<std::byte>& input, auto value)
+        { return ztd::from_varint(input.data(), input.data() + input.size(), value).ec; };
+
+        CHECK_EQ(decode(bytes(0xac, 0x02), 0_u16), std::errc());
+        CHECK_EQ(decode(bytes(), 0_u16), std::errc::invalid_argument);
+        CHECK_EQ(decode(bytes(0xac), 0_u16), std::errc::invalid_argument);
+
+        // 256 does not fit, same as checked_create
+        CHECK_EQ(decode(bytes(0x80, 0x02), 0_u8), std::errc::result_out_of_range);
+        CHECK_EQ(decode(bytes(0x80, 0x80, 0x00), 0_u8), std::errc::result_out_of_range);
+        CHECK_EQ(decode(bytes(0xff, 0xff, 0xff, 0xff, 0x1f), 0_u32),
+                 std::errc::result_out_of_range);
+        CHECK_EQ(decode(bytes(0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x02), 0_u64),
+                 std::errc::result_out_of_range);
+
+        ztd::u8 value = 7_u8;
+        const auto bad = bytes(0x80, 0x02);
+        CHECK_EQ(ztd::from_varint(bad.data(), bad.data() + bad.size(), value).ptr, bad.data());
+        CHECK_EQ(value, 7_u8);
+    }
+
+    TEST_CASE_TEMPLATE("round trip ",
+                       Integer,
+                       ztd::v2::i8,
+                       ztd::v2::i16,
+                       ztd::v2::i32,
+                       ztd::v2::i64,
+                       ztd::v2::u8,
+                       ztd::v2::u16,
+                       ztd::v2::u32,
+                       ztd::v2::u64)
+    {
+        const auto values = varint_values<Integer>();
+
+        const auto encoded = ztd::encode_varints(std::span(values));
+
+        // the bulk encoder matches the scalar one
+        std::vector<std::byte> expected;
+        for (const auto value : values)
+        {
+            std::array<std::byte, ztd::varint_max_bytes<Integer>> buffer;
+            const auto [ptr, ec] =
+                ztd::to_varint(buffer.data(), buffer.data() + buffer.size(), value);
+            REQUIRE_EQ(ec, std::errc());
+            expected.insert(expected.end(), buffer.data(), ptr);
+        }
+        CHECK_EQ(encoded, expected);
+
+        const auto decoded = ztd::decode_varints<Integer>(encoded);
+        REQUIRE(decoded.has_value());
+        CHECK_EQ(*decoded, values);
+
+        // scalar decoding
+        const std::byte* ptr = encoded.data();
+        for (const auto value : values)
+        {
+            Integer result;
+            const auto r = ztd::from_varint(ptr, encoded.data() + encoded.size(), result);
+            REQUIRE_EQ(r.ec, std::errc());
+            CHECK_EQ(result, value);
+            ptr = r.ptr;
+        }
+        CHECK_EQ(ptr, encoded.data() + encoded.size());
+    }
+
+    TEST_CASE("bulk decoding errors")
+    {
+        // the value that does not fit is found on the word at a time path
+        std::vector<ztd::u32> values(20, 5_u32);
+        values[3] = 300_u32;
+        const auto encoded = ztd::encode_varints(std::span(values));
+        CHECK_EQ(ztd::decode_varints<ztd::u8>(encoded).error(), 3);
+        CHECK_EQ(ztd::decode_varints<ztd::u16>(encoded)->size(), 20);
+
+        // an overlong encoding of 0 for u8 is 3 bytes
+        auto overlong = bytes(0x80, 0x80, 0x00);
+        overlong.resize(16, std::byte(0));
+        CHECK_EQ(ztd::decode_varints<ztd::u8>(overlong).error(), 0);
+
+        // truncated at the end
+        auto truncated = encoded;
+        truncated.push_back(std::byte(0x80));
+        CHECK_EQ(ztd::decode_varints<ztd::u32>(truncated).error(), 20);
+
+        CHECK(ztd::decode_varints<ztd::u32>({})->empty());
+    }
+}